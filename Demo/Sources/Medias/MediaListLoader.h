@@ -0,0 +1,43 @@
+//
+//  Copyright (c) SRG SSR. All rights reserved.
+//
+//  License information is available from the LICENSE file.
+//
+
+#import <Foundation/Foundation.h>
+
+NS_ASSUME_NONNULL_BEGIN
+
+/**
+ *  Load a media list asynchronously, keeping an on-disk copy of the last parsed list so that a screen can display
+ *  known content immediately while the list is refreshed in the background. The demo reads its lists from bundled
+ *  property lists, but the same pipeline applies when the list is fetched over the network and parsing thousands
+ *  of entries would otherwise block screen construction.
+ */
+@interface MediaListLoader : NSObject
+
+/**
+ *  Create a loader for the media list with the specified file name (without extension).
+ */
+- (instancetype)initWithMediaFileName:(NSString *)mediaFileName;
+
+/**
+ *  The media list file name.
+ */
+@property (nonatomic, readonly, copy) NSString *mediaFileName;
+
+/**
+ *  Return the media list saved by a previous load, `nil` if none is available yet. Cached lists are small binary
+ *  property lists and deserialize fast enough to be read synchronously at screen construction.
+ */
+- (nullable NSArray<NSDictionary *> *)cachedMedias;
+
+/**
+ *  Load and parse the media list on a background queue, then save it to disk and call the completion block on the
+ *  main thread.
+ */
+- (void)loadWithCompletionBlock:(void (^)(NSArray<NSDictionary *> *medias))completionBlock;
+
+@end
+
+NS_ASSUME_NONNULL_END
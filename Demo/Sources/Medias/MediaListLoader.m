@@ -0,0 +1,67 @@
+//
+//  Copyright (c) SRG SSR. All rights reserved.
+//
+//  License information is available from the LICENSE file.
+//
+
+#import "MediaListLoader.h"
+
+@interface MediaListLoader ()
+
+@property (nonatomic, copy) NSString *mediaFileName;
+
+@end
+
+@implementation MediaListLoader
+
+#pragma mark Object lifecycle
+
+- (instancetype)initWithMediaFileName:(NSString *)mediaFileName
+{
+    if (self = [super init]) {
+        self.mediaFileName = mediaFileName;
+    }
+    return self;
+}
+
+#pragma mark Cache
+
+- (NSString *)cacheFilePath
+{
+    NSString *cachesDirectory = NSSearchPathForDirectoriesInDomains(NSCachesDirectory, NSUserDomainMask, YES).firstObject;
+    return [cachesDirectory stringByAppendingPathComponent:[NSString stringWithFormat:@"%@-medias.plist", self.mediaFileName]];
+}
+
+- (NSArray<NSDictionary *> *)cachedMedias
+{
+    NSData *data = [NSData dataWithContentsOfFile:[self cacheFilePath]];
+    if (! data) {
+        return nil;
+    }
+
+    id medias = [NSPropertyListSerialization propertyListWithData:data options:NSPropertyListImmutable format:NULL error:NULL];
+    return [medias isKindOfClass:NSArray.class] ? medias : nil;
+}
+
+- (void)saveMediasToCache:(NSArray<NSDictionary *> *)medias
+{
+    NSData *data = [NSPropertyListSerialization dataWithPropertyList:medias format:NSPropertyListBinaryFormat_v1_0 options:0 error:NULL];
+    [data writeToFile:[self cacheFilePath] atomically:YES];
+}
+
+#pragma mark Loading
+
+- (void)loadWithCompletionBlock:(void (^)(NSArray<NSDictionary *> *medias))completionBlock
+{
+    NSString *filePath = [[NSBundle bundleForClass:self.class] pathForResource:self.mediaFileName ofType:@"plist"];
+    dispatch_async(dispatch_get_global_queue(DISPATCH_QUEUE_PRIORITY_DEFAULT, 0), ^{
+        NSDictionary *mediaURLs = [NSDictionary dictionaryWithContentsOfFile:filePath];
+        NSArray<NSDictionary *> *medias = mediaURLs[@"Medias"] ?: @[];
+        [self saveMediasToCache:medias];
+        dispatch_async(dispatch_get_main_queue(), ^{
+            completionBlock(medias);
+        });
+    });
+}
+
+@end
@@ -7,6 +7,7 @@
 #import "MediasViewController.h"
 
 #import "InlinePlayerViewController.h"
+#import "MediaListLoader.h"
 #import "MultiPlayerViewController.h"
 #import "NSBundle+Demo.h"
 #import "Segment.h"
@@ -19,6 +20,7 @@
 @interface MediasViewController ()
 
 @property (nonatomic, copy) NSString *mediaFileName;
+@property (nonatomic) MediaListLoader *mediaListLoader;
 @property (nonatomic) NSArray *medias;
 @property (nonatomic) NSIndexPath *selectedIndexPath;
 
@@ -41,22 +43,70 @@
 - (void)viewDidLoad
 {
     [super viewDidLoad];
-    
+
     self.selectedIndexPath = [NSIndexPath indexPathForRow:0 inSection:0];
+
+    // Display the last known list immediately (parsing never blocks screen construction), then refresh it in the
+    // background and apply the differences incrementally
+    self.mediaListLoader = [[MediaListLoader alloc] initWithMediaFileName:self.mediaFileName];
+    self.medias = [self.mediaListLoader cachedMedias] ?: @[];
+
+    __weak MediasViewController *weakSelf = self;
+    [self.mediaListLoader loadWithCompletionBlock:^(NSArray<NSDictionary *> *medias) {
+        [weakSelf updateWithMedias:medias];
+    }];
 }
 
-#pragma mark Plist configuration extraction
+#pragma mark Media list updates
 
-- (NSArray *)medias
+- (void)updateWithMedias:(NSArray<NSDictionary *> *)medias
 {
-    if (! _medias) {
-        NSDictionary *mediaURLs = [NSDictionary dictionaryWithContentsOfFile:[[NSBundle bundleForClass:self.class] pathForResource:self.mediaFileName ofType:@"plist"]];
-        _medias = mediaURLs[@"Medias"];
+    NSArray *previousMedias = self.medias;
+    if ([medias isEqualToArray:previousMedias]) {
+        return;
     }
 
-    return _medias;
+    self.medias = medias;
+
+    if (self.selectedIndexPath.row >= medias.count) {
+        self.selectedIndexPath = [NSIndexPath indexPathForRow:0 inSection:0];
+    }
+
+    NSArray<NSString *> *previousNames = [previousMedias valueForKey:@"name"];
+    NSArray<NSString *> *names = [medias valueForKey:@"name"];
+
+    // Only plain insertions and deletions are applied incrementally. Reordered lists are rare and simply reloaded
+    NSMutableArray<NSIndexPath *> *deletedIndexPaths = [NSMutableArray array];
+    [previousNames enumerateObjectsUsingBlock:^(NSString *name, NSUInteger idx, BOOL *stop) {
+        if (! [names containsObject:name]) {
+            [deletedIndexPaths addObject:[NSIndexPath indexPathForRow:idx inSection:0]];
+        }
+    }];
+    NSMutableArray<NSIndexPath *> *insertedIndexPaths = [NSMutableArray array];
+    [names enumerateObjectsUsingBlock:^(NSString *name, NSUInteger idx, BOOL *stop) {
+        if (! [previousNames containsObject:name]) {
+            [insertedIndexPaths addObject:[NSIndexPath indexPathForRow:idx inSection:0]];
+        }
+    }];
+
+    NSMutableArray<NSString *> *remainingNames = [previousNames mutableCopy];
+    [remainingNames removeObjectsInArray:[previousNames filteredArrayUsingPredicate:[NSPredicate predicateWithFormat:@"NOT SELF IN %@", names]]];
+    NSMutableArray<NSString *> *targetNames = [names mutableCopy];
+    [targetNames removeObjectsInArray:[names filteredArrayUsingPredicate:[NSPredicate predicateWithFormat:@"NOT SELF IN %@", previousNames]]];
+
+    if (previousMedias.count != 0 && [remainingNames isEqualToArray:targetNames]) {
+        [self.tableView beginUpdates];
+        [self.tableView deleteRowsAtIndexPaths:[deletedIndexPaths copy] withRowAnimation:UITableViewRowAnimationAutomatic];
+        [self.tableView insertRowsAtIndexPaths:[insertedIndexPaths copy] withRowAnimation:UITableViewRowAnimationAutomatic];
+        [self.tableView endUpdates];
+    }
+    else {
+        [self.tableView reloadData];
+    }
 }
 
+#pragma mark Plist configuration extraction
+
 - (NSURL *)URLForMediaAtIndex:(NSInteger)index
 {
     return [NSURL URLWithString:self.medias[index][@"url"]];
@@ -70,6 +70,7 @@
     _selectedIndex = selectedIndex;
     
     SRGMediaPlayerController *mainMediaPlayerController = self.mediaPlayerControllers[selectedIndex];
+    mainMediaPlayerController.playbackPriority = SRGMediaPlayerPlaybackPriorityForeground;
     [mainMediaPlayerController reloadPlayerConfiguration];
     [self attachPlayer:mainMediaPlayerController toView:self.mainPlayerView];
     
@@ -88,6 +89,7 @@
         [self.playerViewsContainer addSubview:playerView];
         
         SRGMediaPlayerController *thumbnailMediaPlayerController = self.mediaPlayerControllers[index];
+        thumbnailMediaPlayerController.playbackPriority = SRGMediaPlayerPlaybackPriorityBackground;
         [thumbnailMediaPlayerController reloadPlayerConfiguration];
         [self attachPlayer:thumbnailMediaPlayerController toView:playerView];
     }
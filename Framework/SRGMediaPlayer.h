@@ -14,15 +14,23 @@ FOUNDATION_EXPORT NSString *SRGMediaPlayerMarketingVersion(void);
 #import "SRGActivityGestureRecognizer.h"
 #import "SRGAirplayButton.h"
 #import "SRGAirplayView.h"
+#import "SRGMediaPlayerAssetCache.h"
 #import "SRGMediaPlayerConstants.h"
 #import "SRGMediaPlayerController.h"
 #import "SRGMediaPlayerError.h"
+#import "SRGMediaPlayerPlaybackSnapshot.h"
+#import "SRGMediaPlayerPlaybackStateChange.h"
+#import "SRGMediaPlayerResourceGovernor.h"
+#import "SRGMediaPlayerStartupMetrics.h"
+#import "SRGMediaPlayerTelemetryReport.h"
+#import "SRGMediaPlayerThumbnailCache.h"
 #import "SRGMediaPlayerView.h"
 #import "SRGMediaPlayerViewController.h"
 #import "SRGPictureInPictureButton.h"
 #import "SRGPlaybackActivityIndicatorView.h"
 #import "SRGPlaybackButton.h"
 #import "SRGSegment.h"
+#import "SRGSegmentStore.h"
 #import "SRGTimelineSlider.h"
 #import "SRGTimelineView.h"
 #import "SRGTimeSlider.h"
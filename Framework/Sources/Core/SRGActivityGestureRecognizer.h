@@ -16,6 +16,15 @@ NS_ASSUME_NONNULL_BEGIN
  */
 @interface SRGActivityGestureRecognizer : UIGestureRecognizer
 
+/**
+ *  Minimum interval between two reported activities. Continuous touch streams (e.g. drags, which deliver dozens
+ *  of touch events per second) are collapsed into a handful of activity callbacks, so that targets resetting a
+ *  timer in response (interface hiding, for example) do not reschedule it on every touch event.
+ *
+ *  Default is 0.3 seconds.
+ */
+@property (nonatomic) NSTimeInterval minimumActivityInterval;
+
 @end
 
 NS_ASSUME_NONNULL_END
@@ -6,8 +6,19 @@
 
 #import "SRGActivityGestureRecognizer.h"
 
+#import <QuartzCore/QuartzCore.h>
 #import <UIKit/UIGestureRecognizerSubclass.h>
 
+static NSTimeInterval const SRGActivityGestureRecognizerDefaultMinimumActivityInterval = 0.3;
+
+@interface SRGActivityGestureRecognizer ()
+
+// Time of the last reported activity, against a monotonic clock. Zeroed when a new touch stream begins so that
+// its first event is always reported immediately
+@property (nonatomic) CFTimeInterval lastActivityReportTime;
+
+@end
+
 // Heavily inspired by MPActivityGestureRecognizer from the MediaPlayer framework
 @implementation SRGActivityGestureRecognizer
 
@@ -18,6 +29,7 @@
     if (self = [super initWithTarget:target action:action]) {
         self.cancelsTouchesInView = NO;
         self.delaysTouchesEnded = NO;
+        self.minimumActivityInterval = SRGActivityGestureRecognizerDefaultMinimumActivityInterval;
     }
     return self;
 }
@@ -27,13 +39,15 @@
 - (void)touchesBegan:(NSSet<UITouch *> *)touches withEvent:(UIEvent *)event
 {
     [self stopReportingOngoingActivity];
+    self.lastActivityReportTime = 0.;
     [self reportOngoingActivity];
 }
 
 - (void)touchesMoved:(NSSet<UITouch *> *)touches withEvent:(UIEvent *)event
 {
-    self.state = UIGestureRecognizerStateChanged;
-    [self reportOngoingActivity];
+    if ([self shouldReportActivity]) {
+        self.state = UIGestureRecognizerStateChanged;
+    }
 }
 
 - (void)touchesEnded:(NSSet<UITouch *> *)touches withEvent:(UIEvent *)event
@@ -51,9 +65,25 @@
 
 #pragma mark Helpers
 
+// Return `YES` iff enough time has elapsed since the last reported activity, in which case the report time is
+// consumed. State transitions fire the associated action, and must therefore only be made when this method
+// returns `YES`
+- (BOOL)shouldReportActivity
+{
+    CFTimeInterval now = CACurrentMediaTime();
+    if (now - self.lastActivityReportTime < self.minimumActivityInterval) {
+        return NO;
+    }
+
+    self.lastActivityReportTime = now;
+    return YES;
+}
+
 - (void)reportOngoingActivity
 {
-    self.state = UIGestureRecognizerStateBegan;
+    if ([self shouldReportActivity]) {
+        self.state = UIGestureRecognizerStateBegan;
+    }
     [self performSelector:_cmd withObject:nil afterDelay:1.];
 }
 
@@ -0,0 +1,62 @@
+//
+//  Copyright (c) SRG SSR. All rights reserved.
+//
+//  License information is available from the LICENSE file.
+//
+
+#import <Foundation/Foundation.h>
+
+NS_ASSUME_NONNULL_BEGIN
+
+// Forward declarations
+@class SRGAirplayRouteService;
+
+/**
+ *  Observers interested in wireless route changes (see `SRGAirplayRouteService`).
+ */
+@protocol SRGAirplayRouteObserver <NSObject>
+
+/**
+ *  Called on the main thread when the wireless route state has changed (route availability or activity, external
+ *  screen connection).
+ */
+- (void)airplayRouteServiceDidDetectChange:(SRGAirplayRouteService *)service;
+
+@end
+
+/**
+ *  Service maintaining the current wireless route state with a single set of system observations, and multicasting
+ *  changes to lightweight observers. Without it, every Airplay user interface element registers its own route
+ *  observations, which on screens with several players means a dozen redundant observers all reacting to the same
+ *  route event.
+ *
+ *  Observers are referenced weakly and must be registered and unregistered from the main thread.
+ */
+@interface SRGAirplayRouteService : NSObject
+
+/**
+ *  The service singleton.
+ */
++ (SRGAirplayRouteService *)sharedService;
+
+/**
+ *  The current route state, kept up to date by the service (no system query is made when reading these properties).
+ */
+@property (nonatomic, readonly, getter=areWirelessRoutesAvailable) BOOL wirelessRoutesAvailable;
+@property (nonatomic, readonly, getter=isWirelessRouteActive) BOOL wirelessRouteActive;
+
+/**
+ *  Register / unregister an observer. Registering an already registered observer does nothing.
+ */
+- (void)addRouteObserver:(id<SRGAirplayRouteObserver>)observer;
+- (void)removeRouteObserver:(id<SRGAirplayRouteObserver>)observer;
+
+@end
+
+@interface SRGAirplayRouteService (Unavailable)
+
+- (instancetype)init NS_UNAVAILABLE;
+
+@end
+
+NS_ASSUME_NONNULL_END
@@ -0,0 +1,126 @@
+//
+//  Copyright (c) SRG SSR. All rights reserved.
+//
+//  License information is available from the LICENSE file.
+//
+
+#import "SRGAirplayRouteService.h"
+
+#import "AVAudioSession+SRGMediaPlayer.h"
+
+#import <MediaPlayer/MediaPlayer.h>
+#import <UIKit/UIKit.h>
+
+@interface SRGAirplayRouteService ()
+
+// Offscreen volume view from which the route state is observed (its notifications fire regardless of window
+// membership)
+@property (nonatomic) MPVolumeView *volumeView;
+
+@property (nonatomic, getter=areWirelessRoutesAvailable) BOOL wirelessRoutesAvailable;
+@property (nonatomic, getter=isWirelessRouteActive) BOOL wirelessRouteActive;
+
+@property (nonatomic) NSHashTable<id<SRGAirplayRouteObserver>> *observers;
+
+@end
+
+@implementation SRGAirplayRouteService
+
+#pragma mark Class methods
+
++ (SRGAirplayRouteService *)sharedService
+{
+    static SRGAirplayRouteService *s_sharedService;
+    static dispatch_once_t s_onceToken;
+    dispatch_once(&s_onceToken, ^{
+        s_sharedService = [[SRGAirplayRouteService alloc] init];
+    });
+    return s_sharedService;
+}
+
+#pragma mark Object lifecycle
+
+- (instancetype)init
+{
+    if (self = [super init]) {
+        self.volumeView = [[MPVolumeView alloc] init];
+        self.wirelessRoutesAvailable = self.volumeView.areWirelessRoutesAvailable;
+        self.wirelessRouteActive = self.volumeView.isWirelessRouteActive;
+
+        self.observers = [NSHashTable hashTableWithOptions:NSPointerFunctionsObjectPointerPersonality | NSPointerFunctionsWeakMemory];
+
+        [[NSNotificationCenter defaultCenter] addObserver:self
+                                                 selector:@selector(srg_airplayRouteService_wirelessRouteActiveDidChange:)
+                                                     name:MPVolumeViewWirelessRouteActiveDidChangeNotification
+                                                   object:self.volumeView];
+        [[NSNotificationCenter defaultCenter] addObserver:self
+                                                 selector:@selector(srg_airplayRouteService_wirelessRoutesAvailableDidChange:)
+                                                     name:MPVolumeViewWirelessRoutesAvailableDidChangeNotification
+                                                   object:self.volumeView];
+        [[NSNotificationCenter defaultCenter] addObserver:self
+                                                 selector:@selector(srg_airplayRouteService_screenDidConnect:)
+                                                     name:UIScreenDidConnectNotification
+                                                   object:nil];
+        [[NSNotificationCenter defaultCenter] addObserver:self
+                                                 selector:@selector(srg_airplayRouteService_screenDidDisconnect:)
+                                                     name:UIScreenDidDisconnectNotification
+                                                   object:nil];
+    }
+    return self;
+}
+
+#pragma mark Observer management
+
+- (void)addRouteObserver:(id<SRGAirplayRouteObserver>)observer
+{
+    NSAssert([NSThread isMainThread], @"Must be called from the main thread");
+    [self.observers addObject:observer];
+}
+
+- (void)removeRouteObserver:(id<SRGAirplayRouteObserver>)observer
+{
+    NSAssert([NSThread isMainThread], @"Must be called from the main thread");
+    [self.observers removeObject:observer];
+}
+
+- (void)notifyObservers
+{
+    for (id<SRGAirplayRouteObserver> observer in [self.observers copy]) {
+        [observer airplayRouteServiceDidDetectChange:self];
+    }
+}
+
+#pragma mark Notifications
+
+- (void)srg_airplayRouteService_wirelessRouteActiveDidChange:(NSNotification *)notification
+{
+    self.wirelessRouteActive = self.volumeView.isWirelessRouteActive;
+    [self notifyObservers];
+
+    [[NSNotificationCenter defaultCenter] postNotificationName:SRGMediaPlayerWirelessRouteDidChangeNotification object:nil];
+}
+
+- (void)srg_airplayRouteService_wirelessRoutesAvailableDidChange:(NSNotification *)notification
+{
+    self.wirelessRoutesAvailable = self.volumeView.areWirelessRoutesAvailable;
+    [self notifyObservers];
+}
+
+- (void)srg_airplayRouteService_screenDidConnect:(NSNotification *)notification
+{
+    [self notifyObservers];
+}
+
+- (void)srg_airplayRouteService_screenDidDisconnect:(NSNotification *)notification
+{
+    [self notifyObservers];
+}
+
+@end
+
+__attribute__((constructor)) static void SRGAirplayRouteServiceInit(void)
+{
+    // Instantiate the service at load time so that `SRGMediaPlayerWirelessRouteDidChangeNotification` is emitted
+    // even if no user interface element has subscribed yet
+    (void)[SRGAirplayRouteService sharedService];
+}
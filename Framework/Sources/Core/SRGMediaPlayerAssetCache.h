@@ -0,0 +1,60 @@
+//
+//  Copyright (c) SRG SSR. All rights reserved.
+//
+//  License information is available from the LICENSE file.
+//
+
+#import <AVFoundation/AVFoundation.h>
+#import <Foundation/Foundation.h>
+
+NS_ASSUME_NONNULL_BEGIN
+
+/**
+ *  A cache of prewarmed `AVURLAsset` instances keyed by URL. Asset loading (DNS and TLS resolution, manifest fetch)
+ *  is usually only started when playback begins, which makes the user pay the corresponding latency after tapping a
+ *  media. By prewarming the assets of medias likely to be played next (e.g. while the user scrolls a media list),
+ *  this work happens ahead of time and tap-to-first-frame is drastically reduced.
+ *
+ *  `SRGMediaPlayerController` transparently consumes prewarmed assets when playing a matching URL, no other change
+ *  is required.
+ *
+ *  The cache must only be used from the main thread.
+ */
+@interface SRGMediaPlayerAssetCache : NSObject
+
+/**
+ *  The cache singleton.
+ */
++ (SRGMediaPlayerAssetCache *)sharedAssetCache;
+
+/**
+ *  Start loading an asset for the specified URL and keep it in the cache. Does nothing if an asset for the URL is
+ *  already available.
+ */
+- (void)prewarmAssetForURL:(NSURL *)URL;
+
+/**
+ *  Return the prewarmed asset for the specified URL, removing it from the cache, or `nil` if none is available. An
+ *  asset can only back a single player item, which is why it cannot be vended twice.
+ */
+- (nullable AVURLAsset *)takeAssetForURL:(NSURL *)URL;
+
+/**
+ *  Discard the prewarmed asset for the specified URL, if any.
+ */
+- (void)removeAssetForURL:(NSURL *)URL;
+
+/**
+ *  Discard all prewarmed assets (e.g. in response to a memory warning).
+ */
+- (void)removeAllAssets;
+
+@end
+
+@interface SRGMediaPlayerAssetCache (Unavailable)
+
+- (instancetype)init NS_UNAVAILABLE;
+
+@end
+
+NS_ASSUME_NONNULL_END
@@ -0,0 +1,102 @@
+//
+//  Copyright (c) SRG SSR. All rights reserved.
+//
+//  License information is available from the LICENSE file.
+//
+
+#import "SRGMediaPlayerAssetCache.h"
+
+#import "SRGMediaPlayerLogger.h"
+
+// Keys whose loading resolves the network work (DNS, TLS, manifest fetch) ahead of playback
+static NSArray<NSString *> *SRGMediaPlayerAssetCachePreloadedKeys(void)
+{
+    static NSArray<NSString *> *s_preloadedKeys;
+    static dispatch_once_t s_onceToken;
+    dispatch_once(&s_onceToken, ^{
+        s_preloadedKeys = @[ @"playable", @"duration" ];
+    });
+    return s_preloadedKeys;
+}
+
+@interface SRGMediaPlayerAssetCache ()
+
+@property (nonatomic) NSCache<NSString *, AVURLAsset *> *assets;
+
+@end
+
+@implementation SRGMediaPlayerAssetCache
+
+#pragma mark Class methods
+
++ (SRGMediaPlayerAssetCache *)sharedAssetCache
+{
+    static SRGMediaPlayerAssetCache *s_sharedAssetCache;
+    static dispatch_once_t s_onceToken;
+    dispatch_once(&s_onceToken, ^{
+        s_sharedAssetCache = [[SRGMediaPlayerAssetCache alloc] init];
+    });
+    return s_sharedAssetCache;
+}
+
+#pragma mark Object lifecycle
+
+- (instancetype)init
+{
+    if (self = [super init]) {
+        self.assets = [[NSCache alloc] init];
+    }
+    return self;
+}
+
+#pragma mark Asset management
+
+- (void)prewarmAssetForURL:(NSURL *)URL
+{
+    if (! URL || [self.assets objectForKey:URL.absoluteString]) {
+        return;
+    }
+
+    AVURLAsset *asset = [AVURLAsset assetWithURL:URL];
+    [self.assets setObject:asset forKey:URL.absoluteString];
+
+    // Loading proceeds in the background. The asset can be consumed at any time, playback will simply pick up the
+    // work already performed
+    [asset loadValuesAsynchronouslyForKeys:SRGMediaPlayerAssetCachePreloadedKeys() completionHandler:^{
+        NSError *error = nil;
+        if ([asset statusOfValueForKey:@"playable" error:&error] == AVKeyValueStatusFailed) {
+            SRGMediaPlayerLogWarning(@"AssetCache", @"Prewarming %@ failed with error: %@", URL, error);
+        }
+    }];
+
+    SRGMediaPlayerLogDebug(@"AssetCache", @"Prewarming asset for %@", URL);
+}
+
+- (AVURLAsset *)takeAssetForURL:(NSURL *)URL
+{
+    if (! URL) {
+        return nil;
+    }
+
+    AVURLAsset *asset = [self.assets objectForKey:URL.absoluteString];
+    if (asset) {
+        [self.assets removeObjectForKey:URL.absoluteString];
+    }
+    return asset;
+}
+
+- (void)removeAssetForURL:(NSURL *)URL
+{
+    if (! URL) {
+        return;
+    }
+
+    [self.assets removeObjectForKey:URL.absoluteString];
+}
+
+- (void)removeAllAssets
+{
+    [self.assets removeAllObjects];
+}
+
+@end
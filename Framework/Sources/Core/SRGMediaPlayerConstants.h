@@ -91,6 +91,41 @@ typedef NS_ENUM(NSInteger, SRGMediaPlayerPlaybackState) {
     SRGMediaPlayerPlaybackStateEnded
 };
 
+/**
+ *  Playback priorities, arbitrating decoder resources between concurrent players (see `SRGMediaPlayerResourceGovernor`).
+ */
+typedef NS_ENUM(NSInteger, SRGMediaPlayerPlaybackPriority) {
+    /**
+     *  The stream the user is actually watching. No resource cap is applied.
+     */
+    SRGMediaPlayerPlaybackPriorityForeground = 0,
+    /**
+     *  A secondary stream (e.g. thumbnail player). The peak bit rate is capped so that decoding stays cheap.
+     */
+    SRGMediaPlayerPlaybackPriorityBackground
+};
+
+/**
+ *  Policies describing how a controller responds when its view stops producing visible output (detached from any
+ *  window, hidden, or scrolled entirely offscreen), see `-[SRGMediaPlayerController viewVisibilityPolicy]`.
+ */
+typedef NS_ENUM(NSInteger, SRGMediaPlayerViewVisibilityPolicy) {
+    /**
+     *  Keep rendering even when the view is not visible (default).
+     */
+    SRGMediaPlayerViewVisibilityPolicyNone = 0,
+    /**
+     *  Disconnect the player from its layer while the view is not visible, suspending video decoding. Audio
+     *  playback continues. Rendering resumes instantly when the view becomes visible again.
+     */
+    SRGMediaPlayerViewVisibilityPolicyDetachRendering,
+    /**
+     *  Pause playback while the view is not visible, and resume it when the view becomes visible again. Playback
+     *  paused for other reasons is not resumed.
+     */
+    SRGMediaPlayerViewVisibilityPolicyPause
+};
+
 /**
  *  @name Notifications
  */
@@ -100,6 +135,16 @@ typedef NS_ENUM(NSInteger, SRGMediaPlayerPlaybackState) {
  */
 OBJC_EXTERN NSString * const SRGMediaPlayerPlaybackStateDidChangeNotification;              // Notification name.
 
+/**
+ *  Notification sent at most once per run-loop turn when the player state has changed, coalescing bursts of
+ *  transitions (e.g. during startup or seeks) into a single composite notification. Use the keys available below to
+ *  retrieve the final state, the state before the first transition of the batch, and the intermediate states which
+ *  have been traversed. Observers which only need to refresh their appearance from the current state (e.g. overlays)
+ *  should prefer this notification over `SRGMediaPlayerPlaybackStateDidChangeNotification`, which is sent for every
+ *  single transition.
+ */
+OBJC_EXTERN NSString * const SRGMediaPlayerBatchedPlaybackStateDidChangeNotification;       // Notification name.
+
 /**
  *  Notification sent when playback failed. Use the `SRGMediaPlayerErrorKey` to retrieve an `NSError` information 
  *  from the notification `userInfo` dictionary).
@@ -138,6 +183,26 @@ OBJC_EXTERN NSString * const SRGMediaPlayerSegmentDidEndNotification;
 OBJC_EXTERN NSString * const SRGMediaPlayerWillSkipBlockedSegmentNotification;              // Notification sent when the player starts skipping a blocked segment.
 OBJC_EXTERN NSString * const SRGMediaPlayerDidSkipBlockedSegmentNotification;               // Notification sent when the player finishes skipping a blocked segment.
 
+/**
+ *  Notification sent once playback effectively starts after a playback request, when all startup phases have been
+ *  measured. Use the `SRGMediaPlayerStartupMetricsKey` to retrieve the metrics from the notification `userInfo`
+ *  dictionary.
+ */
+OBJC_EXTERN NSString * const SRGMediaPlayerStartupMetricsDidBecomeAvailableNotification;    // Notification name.
+
+/**
+ *  Notification sent when the media selection groups (subtitles, audio tracks) of the played item have been loaded
+ *  and can be accessed instantly with `-[SRGMediaPlayerController mediaSelectionGroupForMediaCharacteristic:]`.
+ */
+OBJC_EXTERN NSString * const SRGMediaPlayerMediaSelectionGroupsDidBecomeAvailableNotification;  // Notification name.
+
+/**
+ *  Notification sent at a low frequency during playback when quality indicators have been aggregated over a sampling
+ *  window. Use the `SRGMediaPlayerTelemetryReportKey` to retrieve the report from the notification `userInfo`
+ *  dictionary.
+ */
+OBJC_EXTERN NSString * const SRGMediaPlayerTelemetryReportDidBecomeAvailableNotification;   // Notification name.
+
 /**
  *  @name Notification user information keys
  */
@@ -147,12 +212,20 @@ OBJC_EXTERN NSString * const SRGMediaPlayerDidSkipBlockedSegmentNotification;
  */
 OBJC_EXTERN NSString * const SRGMediaPlayerPlaybackStateKey;                                // Key to access the current playback state as an `NSNumber` (wrapping an `SRGMediaPlayerPlaybackState` value).
 OBJC_EXTERN NSString * const SRGMediaPlayerPreviousPlaybackStateKey;                        // Key to access the previous playback state as an `NSNumber` (wrapping an `SRGMediaPlayerPlaybackState` value).
+OBJC_EXTERN NSString * const SRGMediaPlayerPlaybackStateChangeKey;                          // Key to access the transition as a pooled `SRGMediaPlayerPlaybackStateChange` typed payload. Only valid during the notification callout, copy to keep.
 OBJC_EXTERN NSString * const SRGMediaPlayerPreviousContentURLKey;                           // Key to access the previously played URL.
 OBJC_EXTERN NSString * const SRGMediaPlayerPreviousTimeRangeKey;                            // Key to access the previous time range as an `NSValue` (wrapping an `CMTimeRange` value).
 OBJC_EXTERN NSString * const SRGMediaPlayerPreviousMediaTypeKey;                            // Key to access the previous media type as an `NSNumber` (wrapping an `SRGMediaPlayerMediaType` value).
 OBJC_EXTERN NSString * const SRGMediaPlayerPreviousStreamTypeKey;                           // Key to access the previous stream type as an `NSNumber` (wrapping an `SRGMediaPlayerStreamType` value).
 OBJC_EXTERN NSString * const SRGMediaPlayerPreviousUserInfoKey;                             // Key to access the previous user information.
 
+/**
+ *  Information available for `SRGMediaPlayerBatchedPlaybackStateDidChangeNotification` (the playback state and
+ *  previous playback state keys above are available as well, the latter containing the state before the first
+ *  transition of the batch).
+ */
+OBJC_EXTERN NSString * const SRGMediaPlayerIntermediatePlaybackStatesKey;                   // Key to access the intermediate states traversed during the batch, as an `NSArray` of `NSNumber` (wrapping `SRGMediaPlayerPlaybackState` values). Empty for a single transition.
+
 /**
  *  Information available for `SRGMediaPlayerPlaybackDidFailNotification`.
  */
@@ -163,6 +236,16 @@ OBJC_EXTERN NSString * const SRGMediaPlayerErrorKey;
  */
 OBJC_EXTERN NSString * const SRGMediaPlayerSeekTimeKey;                                     // Key to access the time to which the seek is made, as an `NSValue` (wrapping a `CMTime` value).
 
+/**
+ *  Information available for `SRGMediaPlayerStartupMetricsDidBecomeAvailableNotification`.
+ */
+OBJC_EXTERN NSString * const SRGMediaPlayerStartupMetricsKey;                               // Key to access the metrics as an `SRGMediaPlayerStartupMetrics` object.
+
+/**
+ *  Information available for `SRGMediaPlayerTelemetryReportDidBecomeAvailableNotification`.
+ */
+OBJC_EXTERN NSString * const SRGMediaPlayerTelemetryReportKey;                              // Key to access the report as an `SRGMediaPlayerTelemetryReport` object.
+
 // Information available for all segment-related notifications.
 OBJC_EXTERN NSString * const SRGMediaPlayerSegmentKey;                                      // The involved segment as an `id<SRGSegment>` object.
 
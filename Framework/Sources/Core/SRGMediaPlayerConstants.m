@@ -9,6 +9,7 @@
 NSTimeInterval const SRGMediaPlayerLiveDefaultTolerance = 30.;                // Same tolerance as the built-in iOS player
 
 NSString * const SRGMediaPlayerPlaybackStateDidChangeNotification = @"SRGMediaPlayerPlaybackStateDidChangeNotification";
+NSString * const SRGMediaPlayerBatchedPlaybackStateDidChangeNotification = @"SRGMediaPlayerBatchedPlaybackStateDidChangeNotification";
 
 NSString * const SRGMediaPlayerPlaybackDidFailNotification = @"SRGMediaPlayerPlaybackDidFailNotification";
 
@@ -24,18 +25,28 @@ NSString * const SRGMediaPlayerSegmentDidEndNotification = @"SRGMediaPlayerSegme
 NSString * const SRGMediaPlayerWillSkipBlockedSegmentNotification = @"SRGMediaPlayerWillSkipBlockedSegmentNotification";
 NSString * const SRGMediaPlayerDidSkipBlockedSegmentNotification = @"SRGMediaPlayerDidSkipBlockedSegmentNotification";
 
+NSString * const SRGMediaPlayerStartupMetricsDidBecomeAvailableNotification = @"SRGMediaPlayerStartupMetricsDidBecomeAvailableNotification";
+NSString * const SRGMediaPlayerMediaSelectionGroupsDidBecomeAvailableNotification = @"SRGMediaPlayerMediaSelectionGroupsDidBecomeAvailableNotification";
+NSString * const SRGMediaPlayerTelemetryReportDidBecomeAvailableNotification = @"SRGMediaPlayerTelemetryReportDidBecomeAvailableNotification";
+
 NSString * const SRGMediaPlayerPlaybackStateKey = @"SRGMediaPlayerPlaybackStateKey";
 NSString * const SRGMediaPlayerPreviousPlaybackStateKey = @"SRGMediaPlayerPreviousPlaybackStateKey";
+NSString * const SRGMediaPlayerPlaybackStateChangeKey = @"SRGMediaPlayerPlaybackStateChangeKey";
 NSString * const SRGMediaPlayerPreviousContentURLKey = @"SRGMediaPlayerPreviousContentURLKey";
 NSString * const SRGMediaPlayerPreviousTimeRangeKey = @"SRGMediaPlayerPreviousTimeRangeKey";
 NSString * const SRGMediaPlayerPreviousMediaTypeKey = @"SRGMediaPlayerPreviousMediaTypeKey";
 NSString * const SRGMediaPlayerPreviousStreamTypeKey = @"SRGMediaPlayerPreviousStreamTypeKey";
 NSString * const SRGMediaPlayerPreviousUserInfoKey = @"SRGMediaPlayerPreviousUserInfoKey";
 
+NSString * const SRGMediaPlayerIntermediatePlaybackStatesKey = @"SRGMediaPlayerIntermediatePlaybackStatesKey";
+
 NSString * const SRGMediaPlayerErrorKey = @"SRGMediaPlayerErrorKey";
 
 NSString * const SRGMediaPlayerSeekTimeKey = @"SRGMediaPlayerSeekTimeKey";
 
+NSString * const SRGMediaPlayerStartupMetricsKey = @"SRGMediaPlayerStartupMetricsKey";
+NSString * const SRGMediaPlayerTelemetryReportKey = @"SRGMediaPlayerTelemetryReportKey";
+
 NSString * const SRGMediaPlayerSegmentKey = @"SRGMediaPlayerSegmentKey";
 
 NSString * const SRGMediaPlayerSelectedKey = @"SRGMediaPlayerSelectedKey";
@@ -8,6 +8,27 @@
 
 @implementation SRGMediaPlayerIconTemplate
 
+#pragma mark Caching
+
+// Icons are pure functions of their name, size and screen scale. Rasterize them once and reuse the bitmap instead of
+// rebuilding bezier paths and bitmap contexts on each call
++ (UIImage *)cachedImageWithName:(NSString *)name size:(CGSize)size creationBlock:(UIImage * (^)(void))creationBlock
+{
+    static NSCache<NSString *, UIImage *> *s_cache;
+    static dispatch_once_t s_onceToken;
+    dispatch_once(&s_onceToken, ^{
+        s_cache = [[NSCache alloc] init];
+    });
+
+    NSString *key = [NSString stringWithFormat:@"%@_%@_%@_%@", name, @(size.width), @(size.height), @([UIScreen mainScreen].scale)];
+    UIImage *image = [s_cache objectForKey:key];
+    if (! image) {
+        image = creationBlock();
+        [s_cache setObject:image forKey:key];
+    }
+    return image;
+}
+
 #pragma mark Bezier Paths
 
 + (UIImage *)imageWithBezierPath:(UIBezierPath *)bezierPath size:(CGSize)size
@@ -89,17 +110,23 @@
 
 + (UIImage *)playImageWithSize:(CGSize)size
 {
-    return [self imageWithBezierPath:[self playBezierPathWithSize:size] size:size];
+    return [self cachedImageWithName:@"play" size:size creationBlock:^{
+        return [self imageWithBezierPath:[self playBezierPathWithSize:size] size:size];
+    }];
 }
 
 + (UIImage *)pauseImageWithSize:(CGSize)size
 {
-    return [self imageWithBezierPath:[self pauseBezierPathWithSize:size] size:size];
+    return [self cachedImageWithName:@"pause" size:size creationBlock:^{
+        return [self imageWithBezierPath:[self pauseBezierPathWithSize:size] size:size];
+    }];
 }
 
 + (UIImage *)stopImageWithSize:(CGSize)size
 {
-    return [self imageWithBezierPath:[self stopBezierPathWithSize:size] size:size];
+    return [self cachedImageWithName:@"stop" size:size creationBlock:^{
+        return [self imageWithBezierPath:[self stopBezierPathWithSize:size] size:size];
+    }];
 }
 
 @end
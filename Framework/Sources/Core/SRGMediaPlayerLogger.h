@@ -7,10 +7,22 @@
 #import <SRGLogger/SRGLogger.h>
 
 /**
- *  Helper macros for logging.
+ *  Helper macros for logging. Messages are captured in blocks which the installed log handler evaluates only if it
+ *  consumes them (see `SRGLogger`), so the format arguments of discarded messages are never rendered.
+ *
+ *  The verbose and debug levels are used on hot paths (periodic time observers, KVO blocks) where even the residual
+ *  cost of a discarded log site adds up. These levels are therefore compiled out entirely when `DEBUG` is not
+ *  defined. Define `SRGMEDIAPLAYER_ENABLE_DEBUG_LOGGING` to keep them in a release build, e.g. for a diagnostics
+ *  build handed to testers.
  */
+#if defined(DEBUG) || defined(SRGMEDIAPLAYER_ENABLE_DEBUG_LOGGING)
 #define SRGMediaPlayerLogVerbose(category, format, ...) SRGLogVerbose(@"ch.srgssr.mediaplayer", category, format, ##__VA_ARGS__)
 #define SRGMediaPlayerLogDebug(category, format, ...)   SRGLogDebug(@"ch.srgssr.mediaplayer", category, format, ##__VA_ARGS__)
+#else
+#define SRGMediaPlayerLogVerbose(category, format, ...) do {} while (0)
+#define SRGMediaPlayerLogDebug(category, format, ...)   do {} while (0)
+#endif
+
 #define SRGMediaPlayerLogInfo(category, format, ...)    SRGLogInfo(@"ch.srgssr.mediaplayer", category, format, ##__VA_ARGS__)
 #define SRGMediaPlayerLogWarning(category, format, ...) SRGLogWarning(@"ch.srgssr.mediaplayer", category, format, ##__VA_ARGS__)
 #define SRGMediaPlayerLogError(category, format, ...)   SRGLogError(@"ch.srgssr.mediaplayer", category, format, ##__VA_ARGS__)
@@ -0,0 +1,31 @@
+//
+//  Copyright (c) SRG SSR. All rights reserved.
+//
+//  License information is available from the LICENSE file.
+//
+
+#import "SRGMediaPlayerController.h"
+#import "SRGMediaPlayerResourceGovernor.h"
+
+NS_ASSUME_NONNULL_BEGIN
+
+/**
+ *  Private interface for internal use.
+ */
+@interface SRGMediaPlayerResourceGovernor (Private)
+
+/**
+ *  Register / unregister a controller. Registration applies the bit rate cap matching the controller priority to its
+ *  current player item. Controllers are referenced weakly.
+ */
+- (void)registerMediaPlayerController:(SRGMediaPlayerController *)mediaPlayerController;
+- (void)unregisterMediaPlayerController:(SRGMediaPlayerController *)mediaPlayerController;
+
+/**
+ *  Reapply resource caps to all registered controllers (e.g. after a controller priority change).
+ */
+- (void)updateResourceCaps;
+
+@end
+
+NS_ASSUME_NONNULL_END
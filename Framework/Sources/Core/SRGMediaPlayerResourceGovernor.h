@@ -0,0 +1,45 @@
+//
+//  Copyright (c) SRG SSR. All rights reserved.
+//
+//  License information is available from the LICENSE file.
+//
+
+#import <Foundation/Foundation.h>
+
+NS_ASSUME_NONNULL_BEGIN
+
+/**
+ *  Governor keeping track of all media player controllers with an active player, and arbitrating decoder resources
+ *  between them. Video decoding hardware is shared between all players, and on a screen displaying several streams
+ *  at the same time every player would otherwise decode at full quality, starving the stream the user is actually
+ *  watching.
+ *
+ *  Controllers register with the governor automatically when playback starts. Controllers declared as background
+ *  (see `-[SRGMediaPlayerController playbackPriority]`) have their peak bit rate capped so that thumbnail or
+ *  secondary streams stay cheap to decode; the cap is lifted as soon as a controller is promoted to the foreground
+ *  priority.
+ *
+ *  The governor must only be used from the main thread.
+ */
+@interface SRGMediaPlayerResourceGovernor : NSObject
+
+/**
+ *  The governor singleton.
+ */
++ (SRGMediaPlayerResourceGovernor *)sharedGovernor;
+
+/**
+ *  The peak bit rate applied to players with background priority, in bits per second. Default is 1000000 (1 Mbit/s),
+ *  which is sufficient for thumbnail-sized rendering. Changes are applied immediately to all registered controllers.
+ */
+@property (nonatomic) double backgroundPeakBitRate;
+
+@end
+
+@interface SRGMediaPlayerResourceGovernor (Unavailable)
+
+- (instancetype)init NS_UNAVAILABLE;
+
+@end
+
+NS_ASSUME_NONNULL_END
@@ -0,0 +1,96 @@
+//
+//  Copyright (c) SRG SSR. All rights reserved.
+//
+//  License information is available from the LICENSE file.
+//
+
+#import "SRGMediaPlayerResourceGovernor.h"
+
+#import "SRGMediaPlayerController.h"
+#import "SRGMediaPlayerLogger.h"
+
+#import <AVFoundation/AVFoundation.h>
+
+static const double SRGMediaPlayerResourceGovernorDefaultBackgroundPeakBitRate = 1000000.;
+
+@interface SRGMediaPlayerResourceGovernor ()
+
+@property (nonatomic) NSHashTable<SRGMediaPlayerController *> *controllers;
+
+@end
+
+@implementation SRGMediaPlayerResourceGovernor
+
+#pragma mark Class methods
+
++ (SRGMediaPlayerResourceGovernor *)sharedGovernor
+{
+    static SRGMediaPlayerResourceGovernor *s_sharedGovernor;
+    static dispatch_once_t s_onceToken;
+    dispatch_once(&s_onceToken, ^{
+        s_sharedGovernor = [[SRGMediaPlayerResourceGovernor alloc] init];
+    });
+    return s_sharedGovernor;
+}
+
+#pragma mark Object lifecycle
+
+- (instancetype)init
+{
+    if (self = [super init]) {
+        self.controllers = [NSHashTable hashTableWithOptions:NSPointerFunctionsObjectPointerPersonality | NSPointerFunctionsWeakMemory];
+        self.backgroundPeakBitRate = SRGMediaPlayerResourceGovernorDefaultBackgroundPeakBitRate;
+    }
+    return self;
+}
+
+#pragma mark Getters and setters
+
+- (void)setBackgroundPeakBitRate:(double)backgroundPeakBitRate
+{
+    _backgroundPeakBitRate = backgroundPeakBitRate;
+    [self updateResourceCaps];
+}
+
+#pragma mark Controller registration
+
+- (void)registerMediaPlayerController:(SRGMediaPlayerController *)mediaPlayerController
+{
+    NSAssert([NSThread isMainThread], @"Must be called from the main thread");
+
+    [self.controllers addObject:mediaPlayerController];
+    [self applyResourceCapsToMediaPlayerController:mediaPlayerController];
+}
+
+- (void)unregisterMediaPlayerController:(SRGMediaPlayerController *)mediaPlayerController
+{
+    NSAssert([NSThread isMainThread], @"Must be called from the main thread");
+
+    [self.controllers removeObject:mediaPlayerController];
+}
+
+#pragma mark Resource caps
+
+- (void)updateResourceCaps
+{
+    for (SRGMediaPlayerController *mediaPlayerController in [self.controllers copy]) {
+        [self applyResourceCapsToMediaPlayerController:mediaPlayerController];
+    }
+}
+
+- (void)applyResourceCapsToMediaPlayerController:(SRGMediaPlayerController *)mediaPlayerController
+{
+    AVPlayerItem *playerItem = mediaPlayerController.player.currentItem;
+    if (! playerItem) {
+        return;
+    }
+
+    // A peak bit rate of 0 means no limit
+    double peakBitRate = (mediaPlayerController.playbackPriority == SRGMediaPlayerPlaybackPriorityBackground) ? self.backgroundPeakBitRate : 0.;
+    if (playerItem.preferredPeakBitRate != peakBitRate) {
+        playerItem.preferredPeakBitRate = peakBitRate;
+        SRGMediaPlayerLogDebug(@"ResourceGovernor", @"Applied peak bit rate %@ to %@", @(peakBitRate), mediaPlayerController);
+    }
+}
+
+@end
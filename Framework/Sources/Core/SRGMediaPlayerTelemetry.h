@@ -0,0 +1,63 @@
+//
+//  Copyright (c) SRG SSR. All rights reserved.
+//
+//  License information is available from the LICENSE file.
+//
+
+#import "SRGMediaPlayerTelemetryReport.h"
+
+#import <AVFoundation/AVFoundation.h>
+#import <Foundation/Foundation.h>
+
+NS_ASSUME_NONNULL_BEGIN
+
+// Forward declarations
+@class SRGMediaPlayerController;
+
+/**
+ *  Internal pipeline sampling the access and error logs of a player item on a background queue, aggregating playback
+ *  quality indicators into reports (see `SRGMediaPlayerTelemetryReport`). Each controller owns one pipeline per
+ *  playback session.
+ *
+ *  Sampling never touches the item from the main thread and only keeps a weak reference to it, so that it cannot
+ *  race with or delay item teardown.
+ */
+@interface SRGMediaPlayerTelemetry : NSObject
+
+/**
+ *  Create a pipeline publishing reports on behalf of the specified controller.
+ */
+- (instancetype)initWithMediaPlayerController:(SRGMediaPlayerController *)mediaPlayerController;
+
+/**
+ *  Start sampling the logs of the specified item.
+ */
+- (void)startWithPlayerItem:(AVPlayerItem *)playerItem;
+
+/**
+ *  Stop sampling, flushing a last report if pending activity remains.
+ */
+- (void)stop;
+
+/**
+ *  Record stall boundaries, so that the time spent stalled can be aggregated (the access log only provides stall
+ *  counts). Must be called from the main thread.
+ */
+- (void)recordStallStart;
+- (void)recordStallEnd;
+
+/**
+ *  The reports produced during the playback session, from oldest to most recent. At most a fixed number of reports
+ *  is retained. Can be called from any thread.
+ */
+@property (nonatomic, readonly) NSArray<SRGMediaPlayerTelemetryReport *> *recentReports;
+
+@end
+
+@interface SRGMediaPlayerTelemetry (Unavailable)
+
+- (instancetype)init NS_UNAVAILABLE;
+
+@end
+
+NS_ASSUME_NONNULL_END
@@ -0,0 +1,227 @@
+//
+//  Copyright (c) SRG SSR. All rights reserved.
+//
+//  License information is available from the LICENSE file.
+//
+
+#import "SRGMediaPlayerTelemetry.h"
+
+#import "SRGMediaPlayerConstants.h"
+#import "SRGMediaPlayerLogger.h"
+#import "SRGMediaPlayerTelemetryReport+Private.h"
+
+#import <libextobjc/libextobjc.h>
+
+// Reports are published at a low frequency so that observers can batch them cheaply
+static const NSTimeInterval SRGTelemetrySamplingInterval = 10.;
+static const NSTimeInterval SRGTelemetrySamplingLeewayFactor = 0.1;
+
+// Number of reports retained per playback session (ring buffer)
+static const NSUInteger SRGTelemetryReportCapacity = 16;
+
+@interface SRGMediaPlayerTelemetry ()
+
+@property (nonatomic, weak) SRGMediaPlayerController *mediaPlayerController;
+@property (nonatomic, weak) AVPlayerItem *playerItem;
+
+@property (nonatomic) dispatch_queue_t queue;
+@property (nonatomic) dispatch_source_t timer;
+
+// State confined to `queue`
+@property (nonatomic) NSMutableArray<SRGMediaPlayerTelemetryReport *> *reports;
+@property (nonatomic) NSDate *windowStartDate;
+@property (nonatomic) NSUInteger totalStallCount;
+@property (nonatomic) NSUInteger totalBitrateSwitchCount;
+@property (nonatomic) NSUInteger totalErrorCount;
+@property (nonatomic) double lastIndicatedBitrate;
+@property (nonatomic) NSTimeInterval pendingStallDuration;
+@property (nonatomic) NSTimeInterval currentStallStartUptime;          // 0 iff no stall is in progress
+
+@end
+
+@implementation SRGMediaPlayerTelemetry
+
+#pragma mark Object lifecycle
+
+- (instancetype)initWithMediaPlayerController:(SRGMediaPlayerController *)mediaPlayerController
+{
+    if (self = [super init]) {
+        self.mediaPlayerController = mediaPlayerController;
+        self.queue = dispatch_queue_create("ch.srgssr.mediaplayer.telemetry", DISPATCH_QUEUE_SERIAL);
+        self.reports = [NSMutableArray array];
+    }
+    return self;
+}
+
+- (void)dealloc
+{
+    if (self.timer) {
+        dispatch_source_cancel(self.timer);
+    }
+}
+
+#pragma mark Sampling
+
+- (void)startWithPlayerItem:(AVPlayerItem *)playerItem
+{
+    NSAssert([NSThread isMainThread], @"Must be called from the main thread");
+
+    if (self.timer) {
+        return;
+    }
+
+    self.playerItem = playerItem;
+    self.windowStartDate = [NSDate date];
+
+    dispatch_source_t timer = dispatch_source_create(DISPATCH_SOURCE_TYPE_TIMER, 0, 0, self.queue);
+    uint64_t interval = (uint64_t)(SRGTelemetrySamplingInterval * NSEC_PER_SEC);
+    uint64_t leeway = (uint64_t)(SRGTelemetrySamplingInterval * SRGTelemetrySamplingLeewayFactor * NSEC_PER_SEC);
+    dispatch_source_set_timer(timer, dispatch_time(DISPATCH_TIME_NOW, interval), interval, leeway);
+
+    @weakify(self)
+    dispatch_source_set_event_handler(timer, ^{
+        @strongify(self)
+        [self sampleLogs];
+    });
+    dispatch_resume(timer);
+    self.timer = timer;
+
+    SRGMediaPlayerLogDebug(@"Telemetry", @"Started sampling for item %@", playerItem);
+}
+
+- (void)stop
+{
+    NSAssert([NSThread isMainThread], @"Must be called from the main thread");
+
+    if (! self.timer) {
+        return;
+    }
+
+    dispatch_source_t timer = self.timer;
+    self.timer = nil;
+
+    // Flush a last report covering the remainder of the session before cancelling the timer
+    dispatch_async(self.queue, ^{
+        [self sampleLogs];
+        dispatch_source_cancel(timer);
+    });
+}
+
+// Must be called on `queue`
+- (void)sampleLogs
+{
+    // The item is referenced weakly. If it has been torn down in the meantime there is simply nothing to sample
+    AVPlayerItem *playerItem = self.playerItem;
+
+    NSUInteger stallCount = 0;
+    NSUInteger bitrateSwitchCount = 0;
+    double indicatedBitrate = self.lastIndicatedBitrate;
+
+    NSArray<AVPlayerItemAccessLogEvent *> *accessLogEvents = playerItem.accessLog.events;
+    for (AVPlayerItemAccessLogEvent *event in accessLogEvents) {
+        if (event.numberOfStalls > 0) {
+            stallCount += (NSUInteger)event.numberOfStalls;
+        }
+        if (event.indicatedBitrate > 0.) {
+            indicatedBitrate = event.indicatedBitrate;
+        }
+    }
+
+    // Each access log entry past the first one corresponds to a playlist or bitrate switch
+    if (accessLogEvents.count > 0) {
+        bitrateSwitchCount = accessLogEvents.count - 1;
+    }
+
+    NSUInteger errorCount = playerItem.errorLog.events.count;
+
+    // A stall spanning the window boundary is accounted for in the current report, measurement restarts for the next one
+    NSTimeInterval stallDuration = self.pendingStallDuration;
+    self.pendingStallDuration = 0.;
+    if (self.currentStallStartUptime != 0.) {
+        NSTimeInterval uptime = NSProcessInfo.processInfo.systemUptime;
+        stallDuration += uptime - self.currentStallStartUptime;
+        self.currentStallStartUptime = uptime;
+    }
+
+    NSUInteger stallCountDelta = stallCount > self.totalStallCount ? stallCount - self.totalStallCount : 0;
+    NSUInteger bitrateSwitchCountDelta = bitrateSwitchCount > self.totalBitrateSwitchCount ? bitrateSwitchCount - self.totalBitrateSwitchCount : 0;
+    NSUInteger errorCountDelta = errorCount > self.totalErrorCount ? errorCount - self.totalErrorCount : 0;
+
+    // Windows during which nothing noteworthy happened do not produce a report. The current window simply keeps
+    // extending until there is something to say
+    if (stallCountDelta == 0 && bitrateSwitchCountDelta == 0 && errorCountDelta == 0 && stallDuration == 0.
+            && indicatedBitrate == self.lastIndicatedBitrate) {
+        return;
+    }
+
+    self.totalStallCount = stallCount;
+    self.totalBitrateSwitchCount = bitrateSwitchCount;
+    self.totalErrorCount = errorCount;
+    self.lastIndicatedBitrate = indicatedBitrate;
+
+    NSDate *endDate = [NSDate date];
+    SRGMediaPlayerTelemetryReport *report = [[SRGMediaPlayerTelemetryReport alloc] initWithStartDate:self.windowStartDate
+                                                                                            endDate:endDate
+                                                                                         stallCount:stallCountDelta
+                                                                                      stallDuration:stallDuration
+                                                                                   indicatedBitrate:indicatedBitrate
+                                                                                 bitrateSwitchCount:bitrateSwitchCountDelta
+                                                                                         errorCount:errorCountDelta];
+    self.windowStartDate = endDate;
+
+    [self.reports addObject:report];
+    if (self.reports.count > SRGTelemetryReportCapacity) {
+        [self.reports removeObjectAtIndex:0];
+    }
+
+    dispatch_async(dispatch_get_main_queue(), ^{
+        SRGMediaPlayerController *mediaPlayerController = self.mediaPlayerController;
+        if (! mediaPlayerController) {
+            return;
+        }
+
+        [[NSNotificationCenter defaultCenter] postNotificationName:SRGMediaPlayerTelemetryReportDidBecomeAvailableNotification
+                                                            object:mediaPlayerController
+                                                          userInfo:@{ SRGMediaPlayerTelemetryReportKey : report }];
+    });
+
+    SRGMediaPlayerLogDebug(@"Telemetry", @"Published report %@", report);
+}
+
+#pragma mark Stall boundaries
+
+- (void)recordStallStart
+{
+    NSAssert([NSThread isMainThread], @"Must be called from the main thread");
+
+    NSTimeInterval uptime = NSProcessInfo.processInfo.systemUptime;
+    dispatch_async(self.queue, ^{
+        self.currentStallStartUptime = uptime;
+    });
+}
+
+- (void)recordStallEnd
+{
+    NSAssert([NSThread isMainThread], @"Must be called from the main thread");
+
+    NSTimeInterval uptime = NSProcessInfo.processInfo.systemUptime;
+    dispatch_async(self.queue, ^{
+        if (self.currentStallStartUptime != 0.) {
+            self.pendingStallDuration += uptime - self.currentStallStartUptime;
+            self.currentStallStartUptime = 0.;
+        }
+    });
+}
+
+#pragma mark Getters and setters
+
+- (NSArray<SRGMediaPlayerTelemetryReport *> *)recentReports
+{
+    __block NSArray<SRGMediaPlayerTelemetryReport *> *reports = nil;
+    dispatch_sync(self.queue, ^{
+        reports = [self.reports copy];
+    });
+    return reports;
+}
+
+@end
@@ -0,0 +1,29 @@
+//
+//  Copyright (c) SRG SSR. All rights reserved.
+//
+//  License information is available from the LICENSE file.
+//
+
+#import "SRGMediaPlayerTelemetryReport.h"
+
+NS_ASSUME_NONNULL_BEGIN
+
+/**
+ *  Private interface for internal use.
+ */
+@interface SRGMediaPlayerTelemetryReport (Private)
+
+/**
+ *  Create a report covering the specified window.
+ */
+- (instancetype)initWithStartDate:(NSDate *)startDate
+                          endDate:(NSDate *)endDate
+                       stallCount:(NSUInteger)stallCount
+                    stallDuration:(NSTimeInterval)stallDuration
+                 indicatedBitrate:(double)indicatedBitrate
+               bitrateSwitchCount:(NSUInteger)bitrateSwitchCount
+                       errorCount:(NSUInteger)errorCount;
+
+@end
+
+NS_ASSUME_NONNULL_END
@@ -0,0 +1,62 @@
+//
+//  Copyright (c) SRG SSR. All rights reserved.
+//
+//  License information is available from the LICENSE file.
+//
+
+#import <Foundation/Foundation.h>
+
+NS_ASSUME_NONNULL_BEGIN
+
+/**
+ *  Playback quality indicators aggregated over a sampling window. Reports are produced at a low frequency while a
+ *  media is being played, by sampling the player item access and error logs on a background queue. Counters are
+ *  deltas over the report window, which makes reports directly suitable for analytics batching (no subtraction
+ *  required on the application side).
+ *
+ *  Reports are published with `SRGMediaPlayerTelemetryReportDidBecomeAvailableNotification` and the most recent ones
+ *  can be retrieved from the `telemetryReports` property of a controller. Windows during which nothing noteworthy
+ *  happened do not produce a report.
+ */
+@interface SRGMediaPlayerTelemetryReport : NSObject
+
+/**
+ *  The window covered by the report.
+ */
+@property (nonatomic, readonly) NSDate *startDate;
+@property (nonatomic, readonly) NSDate *endDate;
+
+/**
+ *  The number of playback stalls which occurred during the window.
+ */
+@property (nonatomic, readonly) NSUInteger stallCount;
+
+/**
+ *  The total time spent stalled during the window.
+ */
+@property (nonatomic, readonly) NSTimeInterval stallDuration;
+
+/**
+ *  The bitrate indicated by the playlist at the end of the window, in bits per second (0 if unknown).
+ */
+@property (nonatomic, readonly) double indicatedBitrate;
+
+/**
+ *  The number of bitrate switches which occurred during the window.
+ */
+@property (nonatomic, readonly) NSUInteger bitrateSwitchCount;
+
+/**
+ *  The number of entries added to the item error log during the window.
+ */
+@property (nonatomic, readonly) NSUInteger errorCount;
+
+@end
+
+@interface SRGMediaPlayerTelemetryReport (Unavailable)
+
+- (instancetype)init NS_UNAVAILABLE;
+
+@end
+
+NS_ASSUME_NONNULL_END
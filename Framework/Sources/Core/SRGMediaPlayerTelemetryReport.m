@@ -0,0 +1,64 @@
+//
+//  Copyright (c) SRG SSR. All rights reserved.
+//
+//  License information is available from the LICENSE file.
+//
+
+#import "SRGMediaPlayerTelemetryReport.h"
+
+#import "SRGMediaPlayerTelemetryReport+Private.h"
+
+@interface SRGMediaPlayerTelemetryReport ()
+
+@property (nonatomic) NSDate *startDate;
+@property (nonatomic) NSDate *endDate;
+
+@property (nonatomic) NSUInteger stallCount;
+@property (nonatomic) NSTimeInterval stallDuration;
+@property (nonatomic) double indicatedBitrate;
+@property (nonatomic) NSUInteger bitrateSwitchCount;
+@property (nonatomic) NSUInteger errorCount;
+
+@end
+
+@implementation SRGMediaPlayerTelemetryReport
+
+#pragma mark Object lifecycle
+
+- (instancetype)initWithStartDate:(NSDate *)startDate
+                          endDate:(NSDate *)endDate
+                       stallCount:(NSUInteger)stallCount
+                    stallDuration:(NSTimeInterval)stallDuration
+                 indicatedBitrate:(double)indicatedBitrate
+               bitrateSwitchCount:(NSUInteger)bitrateSwitchCount
+                       errorCount:(NSUInteger)errorCount
+{
+    if (self = [super init]) {
+        self.startDate = startDate;
+        self.endDate = endDate;
+        self.stallCount = stallCount;
+        self.stallDuration = stallDuration;
+        self.indicatedBitrate = indicatedBitrate;
+        self.bitrateSwitchCount = bitrateSwitchCount;
+        self.errorCount = errorCount;
+    }
+    return self;
+}
+
+#pragma mark Description
+
+- (NSString *)description
+{
+    return [NSString stringWithFormat:@"<%@: %p; startDate: %@; endDate: %@; stallCount: %@; stallDuration: %@; indicatedBitrate: %@; bitrateSwitchCount: %@; errorCount: %@>",
+            [self class],
+            self,
+            self.startDate,
+            self.endDate,
+            @(self.stallCount),
+            @(self.stallDuration),
+            @(self.indicatedBitrate),
+            @(self.bitrateSwitchCount),
+            @(self.errorCount)];
+}
+
+@end
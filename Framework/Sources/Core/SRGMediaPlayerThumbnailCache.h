@@ -0,0 +1,72 @@
+//
+//  Copyright (c) SRG SSR. All rights reserved.
+//
+//  License information is available from the LICENSE file.
+//
+
+#import <CoreMedia/CoreMedia.h>
+#import <Foundation/Foundation.h>
+#import <UIKit/UIKit.h>
+
+NS_ASSUME_NONNULL_BEGIN
+
+/**
+ *  A cache of small periodic preview frames keyed by URL, used to display thumbnails while scrubbing. Without
+ *  previews users scrub blind and chain several speculative seeks (each with its rebuffering) before finding the
+ *  scene they are looking for; with previews a scrubbing session usually ends in a single final seek.
+ *
+ *  Thumbnails are extracted once in the background and stored as a single strip file on disk, together with a frame
+ *  index. Lookups memory-map the strip, so serving a thumbnail is synchronous and only touches the pages of the
+ *  requested frame, making it cheap enough to be called for every tracking update (see `SRGTimeSliderDelegate`).
+ *
+ *  Extraction requires a seekable on-demand stream, live streams are ignored. The cache must only be used from the
+ *  main thread.
+ */
+@interface SRGMediaPlayerThumbnailCache : NSObject
+
+/**
+ *  The cache singleton.
+ */
++ (SRGMediaPlayerThumbnailCache *)sharedThumbnailCache;
+
+/**
+ *  The maximal size of extracted thumbnails, in points. Default is 160 x 90.
+ */
+@property (nonatomic) CGSize maximumThumbnailSize;
+
+/**
+ *  The time interval between extracted thumbnails, in seconds. Default is 10 seconds.
+ */
+@property (nonatomic) NSTimeInterval thumbnailInterval;
+
+/**
+ *  Start extracting thumbnails for the specified URL in the background, and keep them on disk. Does nothing if
+ *  thumbnails for the URL are already available or being extracted.
+ */
+- (void)prefetchThumbnailsForURL:(NSURL *)URL;
+
+/**
+ *  Return the thumbnail nearest to the specified time, `nil` if none is available (yet). The lookup is synchronous
+ *  and cheap.
+ */
+- (nullable UIImage *)thumbnailForURL:(NSURL *)URL atTime:(CMTime)time;
+
+/**
+ *  Discard the thumbnails for the specified URL, if any.
+ */
+- (void)removeThumbnailsForURL:(NSURL *)URL;
+
+/**
+ *  Discard all thumbnails.
+ */
+- (void)removeAllThumbnails;
+
+@end
+
+@interface SRGMediaPlayerThumbnailCache (Unavailable)
+
+- (instancetype)init NS_UNAVAILABLE;
+
+@end
+
+NS_ASSUME_NONNULL_END
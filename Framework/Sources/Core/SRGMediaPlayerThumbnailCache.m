@@ -0,0 +1,303 @@
+//
+//  Copyright (c) SRG SSR. All rights reserved.
+//
+//  License information is available from the LICENSE file.
+//
+
+#import "SRGMediaPlayerThumbnailCache.h"
+
+#import "SRGMediaPlayerLogger.h"
+
+#import <AVFoundation/AVFoundation.h>
+#import <CommonCrypto/CommonDigest.h>
+
+static const CGSize SRGMediaPlayerThumbnailCacheDefaultMaximumSize = { 160.f, 90.f };
+static const NSTimeInterval SRGMediaPlayerThumbnailCacheDefaultInterval = 10.;
+static const CGFloat SRGMediaPlayerThumbnailCacheCompressionQuality = 0.7f;
+
+// Bound the number of frames per media so that very long streams do not produce unbounded strips
+static const NSUInteger SRGMediaPlayerThumbnailCacheMaximumFrameCount = 400;
+
+static NSString *SRGMediaPlayerThumbnailCacheKeyForURL(NSURL *URL)
+{
+    const char *string = URL.absoluteString.UTF8String;
+    unsigned char digest[CC_MD5_DIGEST_LENGTH];
+    CC_MD5(string, (CC_LONG)strlen(string), digest);
+
+    NSMutableString *key = [NSMutableString string];
+    for (NSUInteger i = 0; i < CC_MD5_DIGEST_LENGTH; ++i) {
+        [key appendFormat:@"%02x", digest[i]];
+    }
+    return [key copy];
+}
+
+static NSString *SRGMediaPlayerThumbnailCacheDirectory(void)
+{
+    static NSString *s_directory;
+    static dispatch_once_t s_onceToken;
+    dispatch_once(&s_onceToken, ^{
+        NSString *cachesDirectory = NSSearchPathForDirectoriesInDomains(NSCachesDirectory, NSUserDomainMask, YES).firstObject;
+        s_directory = [[cachesDirectory stringByAppendingPathComponent:@"ch.srgssr.mediaplayer"] stringByAppendingPathComponent:@"thumbnails"];
+    });
+    return s_directory;
+}
+
+/**
+ *  A thumbnail strip: a single memory-mapped file of concatenated JPEG frames, with an in-memory index of frame
+ *  times and byte ranges. Lookups only touch the pages of the requested frame.
+ */
+@interface SRGThumbnailStrip : NSObject
+
+- (instancetype)initWithData:(NSData *)data index:(NSArray<NSDictionary<NSString *, NSNumber *> *> *)index;
+
+- (nullable UIImage *)thumbnailAtTime:(CMTime)time;
+
+@end
+
+@implementation SRGThumbnailStrip {
+    NSData *_data;
+    NSArray<NSDictionary<NSString *, NSNumber *> *> *_index;        // Sorted by time
+}
+
+- (instancetype)initWithData:(NSData *)data index:(NSArray<NSDictionary<NSString *, NSNumber *> *> *)index
+{
+    if (self = [super init]) {
+        _data = data;
+        _index = index;
+    }
+    return self;
+}
+
+- (UIImage *)thumbnailAtTime:(CMTime)time
+{
+    if (_index.count == 0 || CMTIME_IS_INVALID(time)) {
+        return nil;
+    }
+
+    NSTimeInterval seconds = CMTimeGetSeconds(time);
+
+    // Binary search for the nearest frame
+    NSUInteger low = 0;
+    NSUInteger high = _index.count - 1;
+    while (low < high) {
+        NSUInteger mid = (low + high + 1) / 2;
+        if (_index[mid][@"time"].doubleValue <= seconds) {
+            low = mid;
+        }
+        else {
+            high = mid - 1;
+        }
+    }
+    if (low + 1 < _index.count) {
+        NSTimeInterval lowDistance = fabs(_index[low][@"time"].doubleValue - seconds);
+        NSTimeInterval highDistance = fabs(_index[low + 1][@"time"].doubleValue - seconds);
+        if (highDistance < lowDistance) {
+            ++low;
+        }
+    }
+
+    NSDictionary<NSString *, NSNumber *> *entry = _index[low];
+    NSRange range = NSMakeRange(entry[@"offset"].unsignedIntegerValue, entry[@"length"].unsignedIntegerValue);
+    if (NSMaxRange(range) > _data.length) {
+        return nil;
+    }
+    return [UIImage imageWithData:[_data subdataWithRange:range]];
+}
+
+@end
+
+@interface SRGMediaPlayerThumbnailCache ()
+
+@property (nonatomic) NSMutableDictionary<NSString *, SRGThumbnailStrip *> *strips;
+@property (nonatomic) NSMutableSet<NSString *> *pendingKeys;
+
+@end
+
+@implementation SRGMediaPlayerThumbnailCache
+
+#pragma mark Class methods
+
++ (SRGMediaPlayerThumbnailCache *)sharedThumbnailCache
+{
+    static SRGMediaPlayerThumbnailCache *s_sharedThumbnailCache;
+    static dispatch_once_t s_onceToken;
+    dispatch_once(&s_onceToken, ^{
+        s_sharedThumbnailCache = [[SRGMediaPlayerThumbnailCache alloc] init];
+    });
+    return s_sharedThumbnailCache;
+}
+
+#pragma mark Object lifecycle
+
+- (instancetype)init
+{
+    if (self = [super init]) {
+        self.strips = [NSMutableDictionary dictionary];
+        self.pendingKeys = [NSMutableSet set];
+        self.maximumThumbnailSize = SRGMediaPlayerThumbnailCacheDefaultMaximumSize;
+        self.thumbnailInterval = SRGMediaPlayerThumbnailCacheDefaultInterval;
+    }
+    return self;
+}
+
+#pragma mark Thumbnail management
+
+- (void)prefetchThumbnailsForURL:(NSURL *)URL
+{
+    NSAssert([NSThread isMainThread], @"Must be called from the main thread");
+
+    if (! URL) {
+        return;
+    }
+
+    NSString *key = SRGMediaPlayerThumbnailCacheKeyForURL(URL);
+    if (self.strips[key] || [self.pendingKeys containsObject:key]) {
+        return;
+    }
+    [self.pendingKeys addObject:key];
+
+    // Reuse a strip previously extracted and still on disk
+    if ([self loadStripFromDiskForKey:key]) {
+        [self.pendingKeys removeObject:key];
+        return;
+    }
+
+    SRGMediaPlayerLogDebug(@"ThumbnailCache", @"Extracting thumbnails for %@", URL);
+
+    AVURLAsset *asset = [AVURLAsset assetWithURL:URL];
+    [asset loadValuesAsynchronouslyForKeys:@[ @"duration" ] completionHandler:^{
+        dispatch_async(dispatch_get_main_queue(), ^{
+            CMTime duration = asset.duration;
+            if ([asset statusOfValueForKey:@"duration" error:NULL] != AVKeyValueStatusLoaded
+                    || CMTIME_IS_INDEFINITE(duration) || CMTimeGetSeconds(duration) <= 0.) {
+                [self.pendingKeys removeObject:key];
+                return;
+            }
+            [self extractThumbnailsFromAsset:asset withDuration:duration forKey:key];
+        });
+    }];
+}
+
+- (UIImage *)thumbnailForURL:(NSURL *)URL atTime:(CMTime)time
+{
+    NSAssert([NSThread isMainThread], @"Must be called from the main thread");
+
+    if (! URL) {
+        return nil;
+    }
+
+    NSString *key = SRGMediaPlayerThumbnailCacheKeyForURL(URL);
+    SRGThumbnailStrip *strip = self.strips[key];
+    if (! strip && ! [self.pendingKeys containsObject:key] && [self loadStripFromDiskForKey:key]) {
+        strip = self.strips[key];
+    }
+    return [strip thumbnailAtTime:time];
+}
+
+- (void)removeThumbnailsForURL:(NSURL *)URL
+{
+    NSAssert([NSThread isMainThread], @"Must be called from the main thread");
+
+    if (! URL) {
+        return;
+    }
+
+    NSString *key = SRGMediaPlayerThumbnailCacheKeyForURL(URL);
+    self.strips[key] = nil;
+    [[NSFileManager defaultManager] removeItemAtPath:[self stripPathForKey:key] error:NULL];
+    [[NSFileManager defaultManager] removeItemAtPath:[self indexPathForKey:key] error:NULL];
+}
+
+- (void)removeAllThumbnails
+{
+    NSAssert([NSThread isMainThread], @"Must be called from the main thread");
+
+    [self.strips removeAllObjects];
+    [[NSFileManager defaultManager] removeItemAtPath:SRGMediaPlayerThumbnailCacheDirectory() error:NULL];
+}
+
+#pragma mark Extraction
+
+- (void)extractThumbnailsFromAsset:(AVAsset *)asset withDuration:(CMTime)duration forKey:(NSString *)key
+{
+    NSTimeInterval durationInSeconds = CMTimeGetSeconds(duration);
+    NSTimeInterval interval = fmax(self.thumbnailInterval, durationInSeconds / SRGMediaPlayerThumbnailCacheMaximumFrameCount);
+
+    NSMutableArray<NSValue *> *times = [NSMutableArray array];
+    for (NSTimeInterval position = 0.; position < durationInSeconds; position += interval) {
+        [times addObject:[NSValue valueWithCMTime:CMTimeMakeWithSeconds(position, NSEC_PER_SEC)]];
+    }
+
+    AVAssetImageGenerator *imageGenerator = [AVAssetImageGenerator assetImageGeneratorWithAsset:asset];
+    imageGenerator.maximumSize = CGSizeMake(self.maximumThumbnailSize.width * [UIScreen mainScreen].scale,
+                                            self.maximumThumbnailSize.height * [UIScreen mainScreen].scale);
+    imageGenerator.requestedTimeToleranceBefore = CMTimeMakeWithSeconds(interval / 2., NSEC_PER_SEC);
+    imageGenerator.requestedTimeToleranceAfter = CMTimeMakeWithSeconds(interval / 2., NSEC_PER_SEC);
+
+    NSMutableData *stripData = [NSMutableData data];
+    NSMutableArray<NSDictionary<NSString *, NSNumber *> *> *index = [NSMutableArray array];
+
+    NSUInteger __block remainingCount = times.count;
+    [imageGenerator generateCGImagesAsynchronouslyForTimes:times completionHandler:^(CMTime requestedTime, CGImageRef image, CMTime actualTime, AVAssetImageGeneratorResult result, NSError *error) {
+        // The completion handler is called on a background serial queue, in requested order
+        if (result == AVAssetImageGeneratorSucceeded && image) {
+            NSData *frameData = UIImageJPEGRepresentation([UIImage imageWithCGImage:image], SRGMediaPlayerThumbnailCacheCompressionQuality);
+            if (frameData) {
+                [index addObject:@{ @"time" : @(CMTimeGetSeconds(actualTime)),
+                                    @"offset" : @(stripData.length),
+                                    @"length" : @(frameData.length) }];
+                [stripData appendData:frameData];
+            }
+        }
+
+        if (--remainingCount == 0) {
+            [self saveStripData:[stripData copy] index:[index copy] forKey:key];
+        }
+    }];
+}
+
+- (void)saveStripData:(NSData *)stripData index:(NSArray<NSDictionary<NSString *, NSNumber *> *> *)index forKey:(NSString *)key
+{
+    NSString *stripPath = [self stripPathForKey:key];
+    [[NSFileManager defaultManager] createDirectoryAtPath:stripPath.stringByDeletingLastPathComponent
+                              withIntermediateDirectories:YES
+                                               attributes:nil
+                                                    error:NULL];
+    BOOL saved = index.count != 0
+        && [stripData writeToFile:stripPath atomically:YES]
+        && [index writeToFile:[self indexPathForKey:key] atomically:YES];
+
+    dispatch_async(dispatch_get_main_queue(), ^{
+        [self.pendingKeys removeObject:key];
+        if (saved) {
+            [self loadStripFromDiskForKey:key];
+            SRGMediaPlayerLogDebug(@"ThumbnailCache", @"Extracted %@ thumbnails (%@ bytes) for key %@", @(index.count), @(stripData.length), key);
+        }
+    });
+}
+
+#pragma mark Disk storage
+
+- (NSString *)stripPathForKey:(NSString *)key
+{
+    return [SRGMediaPlayerThumbnailCacheDirectory() stringByAppendingPathComponent:[key stringByAppendingPathExtension:@"strip"]];
+}
+
+- (NSString *)indexPathForKey:(NSString *)key
+{
+    return [SRGMediaPlayerThumbnailCacheDirectory() stringByAppendingPathComponent:[key stringByAppendingPathExtension:@"plist"]];
+}
+
+- (BOOL)loadStripFromDiskForKey:(NSString *)key
+{
+    NSData *data = [NSData dataWithContentsOfFile:[self stripPathForKey:key] options:NSDataReadingMappedIfSafe error:NULL];
+    NSArray<NSDictionary<NSString *, NSNumber *> *> *index = [NSArray arrayWithContentsOfFile:[self indexPathForKey:key]];
+    if (! data || index.count == 0) {
+        return NO;
+    }
+
+    self.strips[key] = [[SRGThumbnailStrip alloc] initWithData:data index:index];
+    return YES;
+}
+
+@end
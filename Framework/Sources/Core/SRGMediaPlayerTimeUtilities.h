@@ -0,0 +1,86 @@
+//
+//  Copyright (c) SRG SSR. All rights reserved.
+//
+//  License information is available from the LICENSE file.
+//
+
+#import <CoreMedia/CoreMedia.h>
+#import <Foundation/Foundation.h>
+
+/**
+ *  Small inline `CMTime` helpers shared by the player controller and the overlay views, so that the validity
+ *  checking and position arithmetic repeated on every observation tick is written (and optimized) in one place.
+ */
+
+/**
+ *  Return `YES` iff the time range can be used for position arithmetic (valid, not empty, not indefinite).
+ */
+static inline BOOL SRGMediaPlayerIsUsableTimeRange(CMTimeRange timeRange)
+{
+    return ! CMTIMERANGE_IS_INVALID(timeRange) && ! CMTIMERANGE_IS_EMPTY(timeRange) && ! CMTIMERANGE_IS_INDEFINITE(timeRange);
+}
+
+/**
+ *  Return the time clamped to the specified range. Invalid times and unusable ranges are returned / ignored
+ *  unchanged, so callers do not need separate validity branching before clamping.
+ */
+static inline CMTime SRGMediaPlayerTimeClampedToRange(CMTime time, CMTimeRange timeRange)
+{
+    if (CMTIME_IS_INVALID(time) || ! SRGMediaPlayerIsUsableTimeRange(timeRange)) {
+        return time;
+    }
+    return CMTimeMinimum(CMTimeMaximum(time, timeRange.start), CMTimeRangeGetEnd(timeRange));
+}
+
+/**
+ *  Return the relative position of a time within a range as a fraction in [0; 1] (clamped without branching),
+ *  0 if the time or the range cannot be used.
+ */
+static inline Float64 SRGMediaPlayerTimeFractionForRange(CMTime time, CMTimeRange timeRange)
+{
+    if (CMTIME_IS_INVALID(time) || ! SRGMediaPlayerIsUsableTimeRange(timeRange)) {
+        return 0.;
+    }
+
+    Float64 duration = CMTimeGetSeconds(timeRange.duration);
+    if (duration == 0.) {
+        return 0.;
+    }
+
+    Float64 fraction = CMTimeGetSeconds(CMTimeSubtract(time, timeRange.start)) / duration;
+    return fmin(fmax(fraction, 0.), 1.);
+}
+
+/**
+ *  Return the interval in seconds between a time and the end of a range (e.g. the distance to the live edge of a
+ *  DVR window).
+ */
+static inline NSTimeInterval SRGMediaPlayerTimeIntervalFromRangeEnd(CMTime time, CMTimeRange timeRange)
+{
+    return CMTimeGetSeconds(CMTimeSubtract(CMTimeRangeGetEnd(timeRange), time));
+}
+
+/**
+ *  Single-entry cache for `CMTimeGetSeconds` conversions of a time which rarely changes (e.g. an item duration
+ *  converted on every layout pass). A zero-initialized struct is an empty cache.
+ */
+typedef struct {
+    CMTime time;
+    Float64 seconds;
+} SRGMediaPlayerSecondsCache;
+
+/**
+ *  Return the time converted to seconds, served from the cache when the time has not changed since the previous
+ *  conversion.
+ */
+static inline Float64 SRGMediaPlayerSecondsCached(CMTime time, SRGMediaPlayerSecondsCache *cache)
+{
+    if (CMTIME_IS_VALID(cache->time) && CMTIME_IS_VALID(time) && CMTimeCompare(cache->time, time) == 0) {
+        return cache->seconds;
+    }
+
+    Float64 seconds = CMTimeGetSeconds(time);
+    cache->time = time;
+    cache->seconds = seconds;
+    return seconds;
+}
@@ -10,6 +10,19 @@
 
 NS_ASSUME_NONNULL_BEGIN
 
+/**
+ *  Delegate informed about view visibility changes (see `SRGMediaPlayerViewVisibilityPolicy`).
+ */
+@protocol SRGMediaPlayerViewVisibilityDelegate <NSObject>
+
+/**
+ *  Called when the view started or stopped producing visible output (window membership, hidden state or on-screen
+ *  position change).
+ */
+- (void)mediaPlayerView:(SRGMediaPlayerView *)mediaPlayerView didChangeVisibility:(BOOL)visible;
+
+@end
+
 /**
  *  Private interface for internal use.
  */
@@ -20,6 +33,18 @@ NS_ASSUME_NONNULL_BEGIN
  */
 @property (nonatomic, readonly) AVPlayerLayer *playerLayer;
 
+/**
+ *  Delegate informed about visibility changes. Visibility is tracked when the view moves between windows and when
+ *  it is laid out (which covers scrolling containers, whose cells are laid out or detached as they enter and leave
+ *  the screen).
+ */
+@property (nonatomic, weak, nullable) id<SRGMediaPlayerViewVisibilityDelegate> visibilityDelegate;
+
+/**
+ *  `YES` iff the view currently produces visible output.
+ */
+@property (nonatomic, readonly, getter=isVisibleOnScreen) BOOL visibleOnScreen;
+
 @end
 
 NS_ASSUME_NONNULL_END
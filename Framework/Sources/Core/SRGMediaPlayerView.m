@@ -6,10 +6,21 @@
 
 #import "SRGMediaPlayerView.h"
 
+#import "SRGMediaPlayerView+Private.h"
+
 #import <AVFoundation/AVFoundation.h>
 
+@interface SRGMediaPlayerView ()
+
+@property (nonatomic, weak) id<SRGMediaPlayerViewVisibilityDelegate> visibilityDelegate;
+@property (nonatomic, getter=isVisibleOnScreen) BOOL visibleOnScreen;
+
+@end
+
 @implementation SRGMediaPlayerView
 
+#pragma mark Getters and setters
+
 + (Class)layerClass
 {
     return [AVPlayerLayer class];
@@ -20,4 +31,39 @@
     return (AVPlayerLayer *)self.layer;
 }
 
+#pragma mark Overrides
+
+- (void)didMoveToWindow
+{
+    [super didMoveToWindow];
+
+    [self updateVisibility];
+}
+
+- (void)layoutSubviews
+{
+    [super layoutSubviews];
+
+    [self updateVisibility];
+}
+
+#pragma mark Visibility
+
+- (void)updateVisibility
+{
+    BOOL visibleOnScreen = NO;
+
+    // A view detached from any window (e.g. an unused cell in the reuse pool) or entirely scrolled outside the
+    // window bounds does not produce any visible output
+    if (self.window && ! self.hidden && self.alpha != 0.f) {
+        CGRect frameInWindow = [self convertRect:self.bounds toView:nil];
+        visibleOnScreen = CGRectIntersectsRect(frameInWindow, self.window.bounds);
+    }
+
+    if (visibleOnScreen != self.visibleOnScreen) {
+        self.visibleOnScreen = visibleOnScreen;
+        [self.visibilityDelegate mediaPlayerView:self didChangeVisibility:visibleOnScreen];
+    }
+}
+
 @end
@@ -9,11 +9,31 @@
 
 NS_ASSUME_NONNULL_BEGIN
 
+// Forward declarations
+@class SRGPeriodicTimeObserver;
+
+/**
+ *  An opaque token handed out when a block is registered with a periodic time observer. Keep it to unregister the
+ *  block later. The token retains the block, so that per-tick fan-out is a plain array walk without any hashing or
+ *  dictionary lookup.
+ */
+@interface SRGPeriodicTimeObserverToken : NSObject
+
+/**
+ *  The observer which issued the token, `nil` once the registration has been removed.
+ */
+@property (nonatomic, readonly, weak, nullable) SRGPeriodicTimeObserver *periodicTimeObserver;
+
+@end
+
 /**
  *  A periodic time observer calls one or several blocks during playback of an associated player. Unlike usual time
  *  observers associated with an `AVPlayer`, an `SRGPeriodicTimeObserver` executes during the lifetime of the player,
- *  also when it is paused, which makes it useful when updates must be made continuously (e.g. UI updates for paused 
+ *  also when it is paused, which makes it useful when updates must be made continuously (e.g. UI updates for paused
  *  DVR streams).
+ *
+ *  Main-queue observers are driven by the shared coalesced timer hub. Observers targeting another queue are driven
+ *  by a timer scheduled on that queue directly, and are therefore not delayed by main-thread congestion.
  */
 @interface SRGPeriodicTimeObserver : NSObject
 
@@ -26,39 +46,42 @@ NS_ASSUME_NONNULL_BEGIN
 - (instancetype)initWithInterval:(CMTime)interval queue:(nullable dispatch_queue_t)queue NS_DESIGNATED_INITIALIZER;
 
 /**
- *  Register a block for a given identifier. If a block with the same identifier has already been registered, it
- *  is simply replaced.
+ *  Register a block, returning the token with which it can be unregistered.
  *
- *  @param block      The block to register (mandatory).
- *  @param identifier The identifier to which the block must be associated.
+ *  @param block The block to register (mandatory).
  */
-- (void)setBlock:(void (^)(CMTime time))block forIdentifier:(NSString *)identifier;
+- (SRGPeriodicTimeObserverToken *)addBlock:(void (^)(CMTime time))block;
+
+/**
+ *  Unregister the block matching the provided token (does nothing if the token is not or no more registered).
+ *
+ *  @param token The token for which the block must be discarded (mandatory).
+ */
+- (void)removeBlockWithToken:(SRGPeriodicTimeObserverToken *)token;
 
 /**
  *  The number of block registrations.
  */
-@property (nonatomic) NSUInteger registrationCount;
+@property (nonatomic, readonly) NSUInteger registrationCount;
 
 /**
- *  Return `YES` iff the periodic time observer has a block registered for the specified identifier.
- *
- *  @param identifier The identifier to look for.
- *
- *  @return `YES` iff found.
+ *  The time interval at which the observer executes all associated blocks.
  */
-- (BOOL)hasBlockWithIdentifier:(id)identifier;
+@property (nonatomic, readonly) CMTime interval;
 
 /**
- *  Unregister the block matching the provided identifier (does nothing if the identifier is not found).
+ *  When set to `YES`, the observer runs at a relaxed cadence: its effective interval is stretched to at least one
+ *  second. Intended for players which are paused or idle, where a high observation cadence only burns timer wakeups
+ *  without the observed time moving. The nominal `interval` is restored when set back to `NO`.
  *
- *  @param identifier The identifier for which a block must be discarded (mandatory).
+ *  Default is `NO`.
  */
-- (void)removeBlockWithIdentifier:(id)identifier;
+@property (nonatomic, getter=isRelaxed) BOOL relaxed;
 
 /**
- *  The time interval at which the observer executes all associated blocks.
+ *  The serial queue onto which blocks are enqueued.
  */
-@property (nonatomic, readonly) CMTime interval;
+@property (nonatomic, readonly) dispatch_queue_t queue;
 
 /**
  *  The player to which the time observer has been attached, `nil` if none.
@@ -6,13 +6,43 @@
 
 #import "SRGPeriodicTimeObserver.h"
 
-@interface SRGPeriodicTimeObserver ()
+#import "SRGTimerHub.h"
+
+// Fraction of the interval used as timer leeway, as for the shared timer hub
+static const double SRGPeriodicTimeObserverLeewayFactor = 0.1;
+
+// Minimum effective interval of a relaxed observer
+static const NSTimeInterval SRGPeriodicTimeObserverRelaxedTimeInterval = 1.;
+
+@interface SRGPeriodicTimeObserverToken ()
+
+@property (nonatomic, weak) SRGPeriodicTimeObserver *periodicTimeObserver;
+@property (nonatomic, copy) void (^block)(CMTime time);
+
+@end
+
+@implementation SRGPeriodicTimeObserverToken
+
+@end
+
+@interface SRGPeriodicTimeObserver () <SRGTimerHubClient>
 
 @property (nonatomic) CMTime interval;
 @property (nonatomic) dispatch_queue_t queue;
 @property (nonatomic, weak) AVPlayer *player;
-@property (nonatomic) NSMutableDictionary *blocks;
-@property (nonatomic) NSTimer *timer;
+
+// Contiguous token storage, walked linearly on each tick (no hashing, no per-tick allocation)
+@property (nonatomic) NSMutableArray<SRGPeriodicTimeObserverToken *> *tokens;
+
+// Immutable snapshot of the registered tokens, refreshed on each mutation. Atomic on purpose: background-queue
+// observers read it from their timer queue, while tokens are registered and unregistered from the main thread
+@property (atomic, copy, nullable) NSArray<SRGPeriodicTimeObserverToken *> *tokensSnapshot;
+
+@property (nonatomic, getter=isAttachedToTimerHub) BOOL attachedToTimerHub;
+
+// Timer driving background-queue observers directly on their target queue (main-queue observers go through the
+// shared coalesced timer hub instead)
+@property (nonatomic, nullable) dispatch_source_t timerSource;
 
 @end
 
@@ -30,7 +60,7 @@
     if (self = [super init]) {
         self.interval = interval;
         self.queue = queue ?: dispatch_get_main_queue();
-        self.blocks = [NSMutableDictionary dictionary];
+        self.tokens = [NSMutableArray array];
     }
     return self;
 }
@@ -59,71 +89,152 @@
     self.player = nil;
 }
 
-#pragma mark Managing blocks
+#pragma mark Getters and setters
 
-- (void)setBlock:(void (^)(CMTime time))block forIdentifier:(NSString *)identifier
+- (void)setRelaxed:(BOOL)relaxed
 {
-    if (self.blocks.count == 0) {
+    if (_relaxed == relaxed) {
+        return;
+    }
+
+    // The timer registration is made for the effective interval, and must be renewed when it changes (the hub
+    // removes clients by interval as well, the unregistration must occur before the interval changes)
+    BOOL observing = self.attachedToTimerHub || self.timerSource;
+    if (observing) {
+        [self removeObserver];
+    }
+
+    _relaxed = relaxed;
+
+    if (observing) {
         [self startObserver];
     }
+}
 
-    [self.blocks setObject:[block copy] forKey:identifier];
+// The interval at which the backing timer must effectively fire
+- (CMTime)timerInterval
+{
+    if (! self.relaxed) {
+        return self.interval;
+    }
+    return CMTimeMaximum(self.interval, CMTimeMakeWithSeconds(SRGPeriodicTimeObserverRelaxedTimeInterval, NSEC_PER_SEC));
 }
 
-- (BOOL)hasBlockWithIdentifier:(id)identifier
+#pragma mark Managing blocks
+
+- (SRGPeriodicTimeObserverToken *)addBlock:(void (^)(CMTime time))block
 {
-    return self.blocks[identifier] != nil;
+    if (self.tokens.count == 0) {
+        [self startObserver];
+    }
+
+    SRGPeriodicTimeObserverToken *token = [[SRGPeriodicTimeObserverToken alloc] init];
+    token.periodicTimeObserver = self;
+    token.block = block;
+    [self.tokens addObject:token];
+    self.tokensSnapshot = self.tokens;
+    return token;
 }
 
-- (void)removeBlockWithIdentifier:(id)identifier
+- (void)removeBlockWithToken:(SRGPeriodicTimeObserverToken *)token
 {
-    [self.blocks removeObjectForKey:identifier];
+    if (token.periodicTimeObserver != self) {
+        return;
+    }
+
+    token.periodicTimeObserver = nil;
+    [self.tokens removeObjectIdenticalTo:token];
+    self.tokensSnapshot = self.tokens;
 
-    if (self.blocks.count == 0) {
+    if (self.tokens.count == 0) {
         [self removeObserver];
     }
 }
 
 - (NSUInteger)registrationCount
 {
-    return self.blocks.count;
+    return self.tokens.count;
 }
 
 #pragma mark Observers
 
 - (void)startObserver
 {
-    if (! self.player || self.timer) {
+    if (! self.player || self.attachedToTimerHub || self.timerSource) {
         return;
     }
-    
-    self.timer = [NSTimer scheduledTimerWithTimeInterval:CMTimeGetSeconds(self.interval)
-                                                  target:self
-                                                selector:@selector(timerTick:)
-                                                userInfo:nil
-                                                 repeats:YES];
+
+    if (self.queue == dispatch_get_main_queue()) {
+        // Observers with compatible intervals share a single coalesced timer, so that a screen with several players
+        // wakes up the main thread only once per interval
+        [[SRGTimerHub sharedHub] addClient:self];
+        self.attachedToTimerHub = YES;
+    }
+    else {
+        // Drive background-queue observers from a timer scheduled on their target queue directly. Routing them
+        // through the main thread would delay delivery under main-thread congestion
+        dispatch_source_t timerSource = dispatch_source_create(DISPATCH_SOURCE_TYPE_TIMER, 0, 0, self.queue);
+        NSTimeInterval timeInterval = CMTimeGetSeconds(self.timerInterval);
+        dispatch_source_set_timer(timerSource,
+                                  dispatch_time(DISPATCH_TIME_NOW, (int64_t)(timeInterval * NSEC_PER_SEC)),
+                                  (uint64_t)(timeInterval * NSEC_PER_SEC),
+                                  (uint64_t)(timeInterval * SRGPeriodicTimeObserverLeewayFactor * NSEC_PER_SEC));
+
+        __weak __typeof(self) weakSelf = self;
+        dispatch_source_set_event_handler(timerSource, ^{
+            [weakSelf timerSourceDidFire];
+        });
+        dispatch_resume(timerSource);
+
+        self.timerSource = timerSource;
+    }
 }
 
 - (void)removeObserver
 {
-    [self.timer invalidate];
-    self.timer = nil;
+    if (self.attachedToTimerHub) {
+        [[SRGTimerHub sharedHub] removeClient:self];
+        self.attachedToTimerHub = NO;
+    }
+
+    if (self.timerSource) {
+        dispatch_source_cancel(self.timerSource);
+        self.timerSource = nil;
+    }
 }
 
-#pragma mark Timers
+#pragma mark SRGTimerHubClient protocol
 
-- (void)timerTick:(NSTimer *)timer
+- (void)timerHubDidFire:(SRGTimerHub *)timerHub
 {
     if (! self.player) {    // It may have disappeared, as it is a weak property
         [self removeObserver];
         return;
     }
 
-    for (void (^block)(CMTime) in [self.blocks allValues]) {
+    // Blocks are dispatched asynchronously, unregistrations they perform cannot mutate the array mid-walk
+    for (SRGPeriodicTimeObserverToken *token in self.tokens) {
+        void (^block)(CMTime) = token.block;
         dispatch_async(self.queue, ^{
             block(self.player.currentTime);
         });
     }
 }
 
+// Called on the target queue of a background-queue observer
+- (void)timerSourceDidFire
+{
+    AVPlayer *player = self.player;
+    if (! player) {     // It may have disappeared, as it is a weak property. Cleanup occurs on the main thread
+        return;
+    }
+
+    // Already on the target queue, execute blocks synchronously. The snapshot is immutable, registrations made
+    // from the main thread replace it atomically
+    CMTime time = player.currentTime;
+    for (SRGPeriodicTimeObserverToken *token in self.tokensSnapshot) {
+        token.block(time);
+    }
+}
+
 @end
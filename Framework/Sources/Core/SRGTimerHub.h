@@ -0,0 +1,70 @@
+//
+//  Copyright (c) SRG SSR. All rights reserved.
+//
+//  License information is available from the LICENSE file.
+//
+
+#import <CoreMedia/CoreMedia.h>
+#import <Foundation/Foundation.h>
+
+NS_ASSUME_NONNULL_BEGIN
+
+// Forward declarations.
+@protocol SRGTimerHubClient;
+
+/**
+ *  A shared hub coalescing periodic clients with compatible intervals onto a single `dispatch_source` timer per
+ *  interval, fired with leeway. Screens hosting several players would otherwise end up with many independent timers
+ *  firing out of phase, each waking up the main thread separately. The hub fans out to all registered clients in a
+ *  single wakeup instead.
+ *
+ *  Clients are weakly referenced. Timers are created lazily when the first client for an interval registers, and
+ *  torn down when the last one unregisters.
+ *
+ *  The hub must only be used from the main thread. Clients are called back on the main thread.
+ */
+@interface SRGTimerHub : NSObject
+
+/**
+ *  The hub singleton.
+ */
++ (SRGTimerHub *)sharedHub;
+
+/**
+ *  Register a client. The client is called back periodically with the interval it declares at registration time.
+ *  Does nothing if the client is already registered.
+ */
+- (void)addClient:(id<SRGTimerHubClient>)client;
+
+/**
+ *  Unregister a client (does nothing if the client is not registered).
+ */
+- (void)removeClient:(id<SRGTimerHubClient>)client;
+
+@end
+
+/**
+ *  Protocol to be implemented by hub clients.
+ */
+@protocol SRGTimerHubClient <NSObject>
+
+/**
+ *  The interval at which the client must be called back. Only read when the client is registered, later changes
+ *  are ignored (a client whose interval must change has to unregister and register again).
+ */
+@property (nonatomic, readonly) CMTime timerInterval;
+
+/**
+ *  Called on the main thread each time the timer associated with the client interval fires.
+ */
+- (void)timerHubDidFire:(SRGTimerHub *)timerHub;
+
+@end
+
+@interface SRGTimerHub (Unavailable)
+
+- (instancetype)init NS_UNAVAILABLE;
+
+@end
+
+NS_ASSUME_NONNULL_END
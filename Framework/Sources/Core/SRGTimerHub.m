@@ -0,0 +1,157 @@
+//
+//  Copyright (c) SRG SSR. All rights reserved.
+//
+//  License information is available from the LICENSE file.
+//
+
+#import "SRGTimerHub.h"
+
+// Fraction of the interval used as timer leeway, letting the system align wakeups belonging to different intervals
+static const double SRGTimerHubLeewayFactor = 0.1;
+
+// Group of clients sharing the same coalesced interval, together with their common timer
+@interface SRGTimerHubBucket : NSObject
+
+- (instancetype)initWithTimeInterval:(NSTimeInterval)timeInterval;
+
+@property (nonatomic) NSTimeInterval timeInterval;
+@property (nonatomic) NSHashTable<id<SRGTimerHubClient>> *clients;
+@property (nonatomic) dispatch_source_t timer;
+
+@end
+
+@implementation SRGTimerHubBucket
+
+- (instancetype)initWithTimeInterval:(NSTimeInterval)timeInterval
+{
+    if (self = [super init]) {
+        self.timeInterval = timeInterval;
+        self.clients = [NSHashTable weakObjectsHashTable];
+    }
+    return self;
+}
+
+- (void)dealloc
+{
+    if (self.timer) {
+        dispatch_source_cancel(self.timer);
+    }
+}
+
+@end
+
+@interface SRGTimerHub ()
+
+@property (nonatomic) NSMutableDictionary<NSNumber *, SRGTimerHubBucket *> *buckets;
+
+@end
+
+@implementation SRGTimerHub
+
+#pragma mark Class methods
+
++ (SRGTimerHub *)sharedHub
+{
+    static SRGTimerHub *s_sharedHub;
+    static dispatch_once_t s_onceToken;
+    dispatch_once(&s_onceToken, ^{
+        s_sharedHub = [[SRGTimerHub alloc] init];
+    });
+    return s_sharedHub;
+}
+
+#pragma mark Object lifecycle
+
+- (instancetype)init
+{
+    if (self = [super init]) {
+        self.buckets = [NSMutableDictionary dictionary];
+    }
+    return self;
+}
+
+#pragma mark Client registration
+
+- (void)addClient:(id<SRGTimerHubClient>)client
+{
+    NSAssert([NSThread isMainThread], @"Must be called from the main thread");
+
+    NSNumber *key = [self bucketKeyForInterval:client.timerInterval];
+    SRGTimerHubBucket *bucket = self.buckets[key];
+    if (! bucket) {
+        bucket = [[SRGTimerHubBucket alloc] initWithTimeInterval:key.doubleValue / 1000.];
+        self.buckets[key] = bucket;
+    }
+
+    if ([bucket.clients containsObject:client]) {
+        return;
+    }
+
+    [bucket.clients addObject:client];
+    [self startTimerForBucket:bucket withKey:key];
+}
+
+- (void)removeClient:(id<SRGTimerHubClient>)client
+{
+    NSAssert([NSThread isMainThread], @"Must be called from the main thread");
+
+    NSNumber *key = [self bucketKeyForInterval:client.timerInterval];
+    SRGTimerHubBucket *bucket = self.buckets[key];
+    if (! bucket) {
+        return;
+    }
+
+    [bucket.clients removeObject:client];
+    if (bucket.clients.count == 0) {
+        [self.buckets removeObjectForKey:key];
+    }
+}
+
+#pragma mark Timers
+
+// Intervals are coalesced at millisecond granularity. Two clients declaring the same interval in different but
+// equivalent `CMTime` representations therefore share the same timer
+- (NSNumber *)bucketKeyForInterval:(CMTime)interval
+{
+    return @(llround(CMTimeGetSeconds(interval) * 1000.));
+}
+
+- (void)startTimerForBucket:(SRGTimerHubBucket *)bucket withKey:(NSNumber *)key
+{
+    if (bucket.timer) {
+        return;
+    }
+
+    dispatch_source_t timer = dispatch_source_create(DISPATCH_SOURCE_TYPE_TIMER, 0, 0, dispatch_get_main_queue());
+    NSTimeInterval timeInterval = bucket.timeInterval;
+    dispatch_source_set_timer(timer,
+                              dispatch_time(DISPATCH_TIME_NOW, (int64_t)(timeInterval * NSEC_PER_SEC)),
+                              (uint64_t)(timeInterval * NSEC_PER_SEC),
+                              (uint64_t)(timeInterval * SRGTimerHubLeewayFactor * NSEC_PER_SEC));
+
+    __weak __typeof(self) weakSelf = self;
+    dispatch_source_set_event_handler(timer, ^{
+        [weakSelf fireBucketWithKey:key];
+    });
+    dispatch_resume(timer);
+
+    bucket.timer = timer;
+}
+
+- (void)fireBucketWithKey:(NSNumber *)key
+{
+    SRGTimerHubBucket *bucket = self.buckets[key];
+
+    // Fan out to all clients in a single wakeup. Clients are weakly referenced and might have disappeared
+    NSArray<id<SRGTimerHubClient>> *clients = bucket.clients.allObjects;
+    if (clients.count == 0) {
+        [self.buckets removeObjectForKey:key];
+        return;
+    }
+
+    for (id<SRGTimerHubClient> client in clients) {
+        [client timerHubDidFire:self];
+    }
+}
+
+@end
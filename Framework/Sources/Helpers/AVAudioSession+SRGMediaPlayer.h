@@ -33,6 +33,19 @@ OBJC_EXTERN NSString * const SRGMediaPlayerWirelessRouteDidChangeNotification;
  */
 + (nullable NSString *)srg_activeAirplayRouteName;
 
+/**
+ *  Set the specified category on the shared audio session and activate it, asynchronously on a background queue.
+ *  Session activation is a known multi-hundred-millisecond operation and must not block the main thread, where it
+ *  would otherwise serialize with the work needed to display the first frame.
+ *
+ *  @param category          The category to apply (see `AVAudioSession`). Only set if it differs from the current one.
+ *  @param completionHandler An optional block called on the main thread when the session has been configured, with
+ *                           the error if configuration failed.
+ *
+ *  @discussion Configuration requests are executed in order on a single serial queue.
+ */
++ (void)srg_configureWithCategory:(NSString *)category completionHandler:(nullable void (^)(NSError * _Nullable error))completionHandler;
+
 @end
 
 NS_ASSUME_NONNULL_END
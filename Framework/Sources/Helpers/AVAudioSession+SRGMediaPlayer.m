@@ -8,10 +8,7 @@
 
 #import "NSBundle+SRGMediaPlayer.h"
 
-#import <MediaPlayer/MediaPlayer.h>
-
-static MPVolumeView *s_volumeView = nil;
-
+// Posted by `SRGAirplayRouteService`, which owns the single route observation for the whole library
 NSString * const SRGMediaPlayerWirelessRouteDidChangeNotification = @"SRGMediaPlayerWirelessRouteDidChangeNotification";
 
 @implementation AVAudioSession (SRGMediaPlayer)
@@ -51,21 +48,32 @@ NSString * const SRGMediaPlayerWirelessRouteDidChangeNotification = @"SRGMediaPl
     }
 }
 
-#pragma mark Notifications
-
-+ (void)srg_wirelessRouteActiveDidChange:(NSNotification *)notification
++ (void)srg_configureWithCategory:(NSString *)category completionHandler:(void (^)(NSError *))completionHandler
 {
-    [[NSNotificationCenter defaultCenter] postNotificationName:SRGMediaPlayerWirelessRouteDidChangeNotification object:nil];
-}
+    static dispatch_queue_t s_queue;
+    static dispatch_once_t s_onceToken;
+    dispatch_once(&s_onceToken, ^{
+        s_queue = dispatch_queue_create("ch.srgssr.mediaplayer.audio_session", DISPATCH_QUEUE_SERIAL);
+    });
 
-@end
+    dispatch_async(s_queue, ^{
+        AVAudioSession *audioSession = [self sharedInstance];
 
-__attribute__((constructor)) static void AVAudioSessionInit(void)
-{
-    s_volumeView = [[MPVolumeView alloc] init];
-    [[NSNotificationCenter defaultCenter] addObserver:[AVAudioSession class]
-                                             selector:@selector(srg_wirelessRouteActiveDidChange:)
-                                                 name:MPVolumeViewWirelessRouteActiveDidChangeNotification
-                                               object:s_volumeView];
+        NSError *error = nil;
+        if (! [audioSession.category isEqualToString:category]) {
+            [audioSession setCategory:category error:&error];
+        }
+        if (! error) {
+            [audioSession setActive:YES error:&error];
+        }
+
+        if (completionHandler) {
+            dispatch_async(dispatch_get_main_queue(), ^{
+                completionHandler(error);
+            });
+        }
+    });
 }
 
+@end
+
@@ -5,6 +5,7 @@
 //
 
 #import <Foundation/Foundation.h>
+#import <UIKit/UIKit.h>
 
 NS_ASSUME_NONNULL_BEGIN
 
@@ -33,6 +34,18 @@ OBJC_EXTERN NSString *SRGMediaPlayerNonLocalizedString(NSString *string);
  */
 + (NSBundle *)srg_mediaPlayerBundle;
 
+/**
+ *  Return an overlay image from the media player resource bundle, cached in memory after the first load.
+ */
++ (nullable UIImage *)srg_mediaPlayerImageNamed:(NSString *)name;
+
+/**
+ *  Load the overlay images and localized string tables into memory. Called automatically in the background when the
+ *  library is loaded, so that the first presentation of the player user interface does not pay any disk access.
+ *  Safe to call from any thread.
+ */
++ (void)srg_preheatMediaPlayerResources;
+
 @end
 
 NS_ASSUME_NONNULL_END
@@ -13,6 +13,33 @@ NSString *SRGMediaPlayerNonLocalizedString(NSString *string)
     return string;
 }
 
+// All overlay images shipped with the library, loaded as a whole on first access. The set is small, loading it at
+// once lets a single background preheat remove disk access from the first presentation of the player user interface
+static NSDictionary<NSString *, UIImage *> *SRGMediaPlayerImages(void)
+{
+    static NSDictionary<NSString *, UIImage *> *s_images;
+    static dispatch_once_t s_onceToken;
+    dispatch_once(&s_onceToken, ^{
+        NSArray<NSString *> *names = @[ @"airplay",
+                                        @"alternate_tracks_button",
+                                        @"alternate_tracks_button_selected",
+                                        @"picture_in_picture_start_button",
+                                        @"picture_in_picture_stop_button",
+                                        @"thumb_timeline_slider" ];
+
+        NSMutableDictionary<NSString *, UIImage *> *images = [NSMutableDictionary dictionary];
+        for (NSString *name in names) {
+            NSString *imagePath = [[NSBundle srg_mediaPlayerBundle] pathForResource:name ofType:@"png"];
+            UIImage *image = [UIImage imageWithContentsOfFile:imagePath];
+            if (image) {
+                images[name] = image;
+            }
+        }
+        s_images = [images copy];
+    });
+    return s_images;
+}
+
 @implementation NSBundle (SRGMediaPlayer)
 
 + (NSBundle *)srg_mediaPlayerBundle
@@ -25,4 +52,25 @@ NSString *SRGMediaPlayerNonLocalizedString(NSString *string)
     return bundle;
 }
 
++ (UIImage *)srg_mediaPlayerImageNamed:(NSString *)name
+{
+    return SRGMediaPlayerImages()[name];
+}
+
++ (void)srg_preheatMediaPlayerResources
+{
+    SRGMediaPlayerImages();
+
+    // Requesting any key loads and caches the whole corresponding table
+    [[NSBundle srg_mediaPlayerBundle] localizedStringForKey:@"" value:@"" table:nil];
+    [[NSBundle srg_mediaPlayerBundle] localizedStringForKey:@"" value:@"" table:@"Accessibility"];
+}
+
 @end
+
+__attribute__((constructor)) static void SRGMediaPlayerBundlePreheatInit(void)
+{
+    dispatch_async(dispatch_get_global_queue(DISPATCH_QUEUE_PRIORITY_LOW, 0), ^{
+        [NSBundle srg_preheatMediaPlayerResources];
+    });
+}
@@ -9,6 +9,7 @@
 #import "AVAudioSession+SRGMediaPlayer.h"
 #import "MPVolumeView+SRGMediaPlayer.h"
 #import "NSBundle+SRGMediaPlayer.h"
+#import "SRGAirplayRouteService.h"
 #import "UIScreen+SRGMediaPlayer.h"
 
 #import <libextobjc/libextobjc.h>
@@ -18,7 +19,7 @@ static UIImage *SRGAirplayButtonImage(void);
 
 static void commonInit(SRGAirplayButton *self);
 
-@interface SRGAirplayButton ()
+@interface SRGAirplayButton () <SRGAirplayRouteObserver>
 
 @property (nonatomic, weak) MPVolumeView *volumeView;
 @property (nonatomic, weak) UIButton *fakeInterfaceBuilderButton;
@@ -62,19 +63,8 @@ static void commonInit(SRGAirplayButton *self);
     if (_mediaPlayerController) {
         [_mediaPlayerController removeObserver:self keyPath:@keypath(_mediaPlayerController.player.usesExternalPlaybackWhileExternalScreenIsActive)];
         [_mediaPlayerController removePeriodicTimeObserver:self.periodicTimeObserver];
-        
-        [[NSNotificationCenter defaultCenter] removeObserver:self
-                                                        name:MPVolumeViewWirelessRouteActiveDidChangeNotification
-                                                      object:self.volumeView];
-        [[NSNotificationCenter defaultCenter] removeObserver:self
-                                                        name:MPVolumeViewWirelessRoutesAvailableDidChangeNotification
-                                                      object:self.volumeView];
-        [[NSNotificationCenter defaultCenter] removeObserver:self
-                                                        name:UIScreenDidConnectNotification
-                                                      object:nil];
-        [[NSNotificationCenter defaultCenter] removeObserver:self
-                                                        name:UIScreenDidDisconnectNotification
-                                                      object:nil];
+
+        [[SRGAirplayRouteService sharedService] removeRouteObserver:self];
     }
     
     _mediaPlayerController = mediaPlayerController;
@@ -91,23 +81,8 @@ static void commonInit(SRGAirplayButton *self);
             @strongify(self)
             [self updateAppearance];
         }];
-        
-        [[NSNotificationCenter defaultCenter] addObserver:self
-                                                 selector:@selector(srg_airplayButton_wirelessRouteActiveDidChange:)
-                                                     name:MPVolumeViewWirelessRouteActiveDidChangeNotification
-                                                   object:self.volumeView];
-        [[NSNotificationCenter defaultCenter] addObserver:self
-                                                 selector:@selector(srg_airplayButton_wirelessRoutesAvailableDidChange:)
-                                                     name:MPVolumeViewWirelessRoutesAvailableDidChangeNotification
-                                                   object:self.volumeView];
-        [[NSNotificationCenter defaultCenter] addObserver:self
-                                                 selector:@selector(srg_airplayButton_screenDidConnect:)
-                                                     name:UIScreenDidConnectNotification
-                                                   object:nil];
-        [[NSNotificationCenter defaultCenter] addObserver:self
-                                                 selector:@selector(srg_airplayButton_screenDidDisconnect:)
-                                                     name:UIScreenDidDisconnectNotification
-                                                   object:nil];
+
+        [[SRGAirplayRouteService sharedService] addRouteObserver:self];
     }
 }
 
@@ -182,7 +157,7 @@ static void commonInit(SRGAirplayButton *self);
     }
     else if (mediaPlayerController) {
         BOOL allowsAirplayPlayback = mediaPlayerController.mediaType != SRGMediaPlayerMediaTypeVideo || mediaPlayerController.allowsExternalNonMirroredPlayback;
-        if (self.volumeView.areWirelessRoutesAvailable && allowsAirplayPlayback) {
+        if ([SRGAirplayRouteService sharedService].areWirelessRoutesAvailable && allowsAirplayPlayback) {
             airplayButton.tintColor = [AVAudioSession srg_isAirplayActive] ? self.activeTintColor : self.tintColor;
             self.hidden = NO;
         }
@@ -191,28 +166,13 @@ static void commonInit(SRGAirplayButton *self);
         }
     }
     else {
-        self.hidden = ! self.fakeInterfaceBuilderButton && ! self.volumeView.areWirelessRoutesAvailable;
+        self.hidden = ! self.fakeInterfaceBuilderButton && ! [SRGAirplayRouteService sharedService].areWirelessRoutesAvailable;
     }
 }
 
-#pragma mark Notifications
-
-- (void)srg_airplayButton_wirelessRoutesAvailableDidChange:(NSNotification *)notification
-{
-    [self updateAppearance];
-}
-
-- (void)srg_airplayButton_wirelessRouteActiveDidChange:(NSNotification *)notification
-{
-    [self updateAppearance];
-}
-
-- (void)srg_airplayButton_screenDidConnect:(NSNotification *)notification
-{
-    [self updateAppearance];
-}
+#pragma mark SRGAirplayRouteObserver protocol
 
-- (void)srg_airplayButton_screenDidDisconnect:(NSNotification *)notification
+- (void)airplayRouteServiceDidDetectChange:(SRGAirplayRouteService *)service
 {
     [self updateAppearance];
 }
@@ -264,8 +224,7 @@ static UIImage *SRGAirplayButtonImage(void)
     static UIImage *image;
     static dispatch_once_t onceToken;
     dispatch_once(&onceToken, ^{
-        NSString *imagePath = [[NSBundle srg_mediaPlayerBundle] pathForResource:@"airplay" ofType:@"png"];
-        image = [[UIImage imageWithContentsOfFile:imagePath] imageWithRenderingMode:UIImageRenderingModeAlwaysTemplate];
+        image = [[NSBundle srg_mediaPlayerImageNamed:@"airplay"] imageWithRenderingMode:UIImageRenderingModeAlwaysTemplate];
     });
     return image;
 }
@@ -8,21 +8,55 @@
 
 #import "AVAudioSession+SRGMediaPlayer.h"
 #import "NSBundle+SRGMediaPlayer.h"
+#import "SRGAirplayRouteService.h"
 #import "UIScreen+SRGMediaPlayer.h"
 #import "SRGMediaPlayerLogger.h"
 
 #import <libextobjc/libextobjc.h>
 #import <MAKVONotificationCenter/MAKVONotificationCenter.h>
 
-@interface SRGAirplayView ()
+@interface SRGAirplayView () <SRGAirplayRouteObserver>
 
-@property (nonatomic) MPVolumeView *volumeView;
 @property (nonatomic, getter=isFakedForInterfaceBuilder) BOOL fakedForInterfaceBuilder;
 
+// Rendering of the static Airplay artwork (frame, curve and title), cached so that route changes only ever lay out
+// the dynamic route description text again
+@property (nonatomic) UIImage *artworkImage;
+@property (nonatomic) CGSize artworkImageSize;
+
+// `YES` iff an appearance update has been scheduled for the end of the current run-loop turn
+@property (nonatomic, getter=isAppearanceUpdatePending) BOOL appearanceUpdatePending;
+
 @end
 
 static void commonInit(SRGAirplayView *self);
 
+// Geometry of the Airplay screen shape within a view of the specified size
+static CGRect SRGAirplayViewShapeRectangleForSize(CGSize size)
+{
+    CGFloat stringRectHeight = 30.f;
+    CGFloat lineWidth = 4.f;
+    CGFloat shapeSeparatorDelta = 5.f;
+    CGFloat quadCurveHeight = 20.f;
+
+    static CGFloat kFillFactor = 0.6f;
+    CGFloat maxWidth = size.width * kFillFactor - 2.f * lineWidth;
+    CGFloat maxHeight = size.height * kFillFactor - stringRectHeight - quadCurveHeight - shapeSeparatorDelta - 10.f;
+    CGFloat aspectRatio = 16.f / 10.f;
+
+    CGFloat width, height;
+    if (maxWidth < maxHeight * aspectRatio) {
+        width = maxWidth;
+        height = width / aspectRatio;
+    }
+    else {
+        height = maxHeight;
+        width = height * aspectRatio;
+    }
+
+    return CGRectMake(size.width / 2.f - width / 2.f, size.height / 2.f - height / 2.f, width, height);
+}
+
 @implementation SRGAirplayView
 
 #pragma mark Object lifecycle
@@ -56,57 +90,55 @@ static void commonInit(SRGAirplayView *self);
     if (_mediaPlayerController) {
         [_mediaPlayerController removeObserver:self keyPath:@keypath(_mediaPlayerController.player.externalPlaybackActive)];
         [_mediaPlayerController removeObserver:self keyPath:@keypath(_mediaPlayerController.player.usesExternalPlaybackWhileExternalScreenIsActive)];
-        
-        [[NSNotificationCenter defaultCenter] removeObserver:self
-                                                        name:MPVolumeViewWirelessRouteActiveDidChangeNotification
-                                                      object:self.volumeView];
-        [[NSNotificationCenter defaultCenter] removeObserver:self
-                                                        name:UIScreenDidConnectNotification
-                                                      object:nil];
-        [[NSNotificationCenter defaultCenter] removeObserver:self
-                                                        name:UIScreenDidDisconnectNotification
-                                                      object:nil];
+
+        [[SRGAirplayRouteService sharedService] removeRouteObserver:self];
     }
-    
+
     _mediaPlayerController = mediaPlayerController;
     [self updateAppearanceForMediaPlayerController:mediaPlayerController];
-    
+
     if (mediaPlayerController) {
         @weakify(self)
         void (^observationBlock)(MAKVONotification *) = ^(MAKVONotification *notification) {
             @strongify(self)
-            [self updateAppearance];
+            [self setNeedsAppearanceUpdate];
         };
-        
+
         [mediaPlayerController addObserver:self keyPath:@keypath(mediaPlayerController.player.externalPlaybackActive) options:0 block:observationBlock];
         [mediaPlayerController addObserver:self keyPath:@keypath(mediaPlayerController.player.usesExternalPlaybackWhileExternalScreenIsActive) options:0 block:observationBlock];
-        
-        [[NSNotificationCenter defaultCenter] addObserver:self
-                                                 selector:@selector(srg_airplayView_wirelessRouteActiveDidChange:)
-                                                     name:MPVolumeViewWirelessRouteActiveDidChangeNotification
-                                                   object:self.volumeView];
-        [[NSNotificationCenter defaultCenter] addObserver:self
-                                                 selector:@selector(srg_airplayView_screenDidConnect:)
-                                                     name:UIScreenDidConnectNotification
-                                                   object:nil];
-        [[NSNotificationCenter defaultCenter] addObserver:self
-                                                 selector:@selector(srg_airplayView_screenDidDisconnect:)
-                                                     name:UIScreenDidDisconnectNotification
-                                                   object:nil];
+
+        [[SRGAirplayRouteService sharedService] addRouteObserver:self];
     }
 }
 
+- (void)setDelegate:(id<SRGAirplayViewDelegate>)delegate
+{
+    _delegate = delegate;
+
+    // The delegate may supply the title attributes baked into the cached artwork
+    self.artworkImage = nil;
+    [self setNeedsDisplay];
+}
+
 #pragma mark Overrides
 
 - (void)willMoveToWindow:(UIWindow *)newWindow
 {
     [super willMoveToWindow:newWindow];
-    
+
     if (newWindow) {
         [self updateAppearance];
     }
 }
 
+- (void)tintColorDidChange
+{
+    [super tintColorDidChange];
+
+    self.artworkImage = nil;
+    [self setNeedsDisplay];
+}
+
 #pragma mark Drawing
 
 - (void)drawRect:(CGRect)rect
@@ -115,51 +147,55 @@ static void commonInit(SRGAirplayView *self);
     if (self.subviews.count != 0) {
         return;
     }
-    
-    CGFloat width, height;
+
+    CGSize size = self.bounds.size;
+
+    // Blit the cached static artwork, only the route description text below it is laid out again
+    if (! self.artworkImage || ! CGSizeEqualToSize(self.artworkImageSize, size)) {
+        self.artworkImage = [self artworkImageWithSize:size];
+        self.artworkImageSize = size;
+    }
+    [self.artworkImage drawAtPoint:CGPointZero];
+
     CGFloat stringRectHeight = 30.f;
     CGFloat stringRectMargin = 5.f;
-    CGFloat lineWidth = 4.f;
-    CGFloat shapeSeparatorDelta = 5.f;
     CGFloat quadCurveHeight = 20.f;
 
-    static CGFloat kFillFactor = 0.6f;
-    CGFloat maxWidth = CGRectGetWidth(self.bounds) * kFillFactor - 2.f * lineWidth;
-    CGFloat maxHeight = CGRectGetHeight(self.bounds) * kFillFactor - stringRectHeight - quadCurveHeight - shapeSeparatorDelta - 10.f;
-    CGFloat aspectRatio = 16.f / 10.f;
+    CGRect rectangle = SRGAirplayViewShapeRectangleForSize(size);
+    CGRect subtitleRect = CGRectMake(stringRectMargin, CGRectGetMaxY(rectangle) + quadCurveHeight - 5.f, size.width - 2.f * stringRectMargin, stringRectHeight);
+    [self drawSubtitleInRect:subtitleRect];
+}
 
-    if (maxWidth < maxHeight * aspectRatio) {
-        width = maxWidth;
-        height = width / aspectRatio;
-    }
-    else {
-        height = maxHeight;
-        width = height * aspectRatio;
-    }
+- (UIImage *)artworkImageWithSize:(CGSize)size
+{
+    CGFloat shapeSeparatorDelta = 5.f;
+    CGFloat quadCurveHeight = 20.f;
+
+    CGRect rectangle = SRGAirplayViewShapeRectangleForSize(size);
+    CGFloat midX = CGRectGetMidX(rectangle);
+    CGFloat width = CGRectGetWidth(rectangle);
+    CGFloat maxY = CGRectGetMaxY(rectangle);
 
-    CGFloat midX = CGRectGetMidX(rect);
-    CGFloat midY = CGRectGetMidY(rect);
+    UIGraphicsBeginImageContextWithOptions(size, NO, 0.f);
 
     CGContextRef context = UIGraphicsGetCurrentContext();
     CGContextSetAllowsAntialiasing(context, YES);
 
     CGContextSetLineWidth(context, 4.f);
     CGContextSetStrokeColorWithColor(context, self.tintColor.CGColor);
-
-    CGRect rectangle = CGRectMake(midX - width / 2.f, midY - height / 2.f, width, height);
     CGContextAddRect(context, rectangle);
     CGContextStrokePath(context);
 
-    CGContextMoveToPoint(context, midX - width / 4.f, midY + height / 2.f + shapeSeparatorDelta);
-    CGContextAddQuadCurveToPoint(context, midX, midY + height / 2.f + quadCurveHeight, midX + width / 4.f, midY + height / 2.f + shapeSeparatorDelta);
+    CGContextMoveToPoint(context, midX - width / 4.f, maxY + shapeSeparatorDelta);
+    CGContextAddQuadCurveToPoint(context, midX, maxY + quadCurveHeight, midX + width / 4.f, maxY + shapeSeparatorDelta);
     CGContextSetFillColorWithColor(context, self.tintColor.CGColor);
     CGContextFillPath(context);
 
-    CGRect titleRect = CGRectInset(rectangle, 8.f, 10.f);
-    [self drawTitleInRect:titleRect];
+    [self drawTitleInRect:CGRectInset(rectangle, 8.f, 10.f)];
 
-    CGRect subtitleRect = CGRectMake(stringRectMargin, midY + height / 2.f + quadCurveHeight - 5.f, CGRectGetMaxX(rect) - 2.f * stringRectMargin, stringRectHeight);
-    [self drawSubtitleInRect:subtitleRect];
+    UIImage *image = UIGraphicsGetImageFromCurrentImageContext();
+    UIGraphicsEndImageContext();
+    return image;
 }
 
 - (void)drawTitleInRect:(CGRect)rect
@@ -197,6 +233,21 @@ static void commonInit(SRGAirplayView *self);
 
 #pragma mark UI
 
+// Coalesce appearance updates into a single one at the end of the current run-loop turn. Route and external playback
+// changes arrive in bursts during route negotiation, a single redraw suffices for all of them
+- (void)setNeedsAppearanceUpdate
+{
+    if (self.appearanceUpdatePending) {
+        return;
+    }
+    self.appearanceUpdatePending = YES;
+
+    dispatch_async(dispatch_get_main_queue(), ^{
+        self.appearanceUpdatePending = NO;
+        [self updateAppearance];
+    });
+}
+
 - (void)updateAppearance
 {
     [self updateAppearanceForMediaPlayerController:self.mediaPlayerController];
@@ -204,15 +255,15 @@ static void commonInit(SRGAirplayView *self);
 
 - (void)updateAppearanceForMediaPlayerController:(SRGMediaPlayerController *)mediaPlayerController
 {
-    // Do not update before the view is actually visible, so that show / hide delegate methods are correclty called 
+    // Do not update before the view is actually visible, so that show / hide delegate methods are correclty called
     if (! self.window) {
         return;
     }
-    
+
     [self setNeedsDisplay];
-    
+
     BOOL wasHidden = self.hidden;
-    
+
     if (mediaPlayerController) {
         if (mediaPlayerController.externalNonMirroredPlaybackActive) {
             self.hidden = ! [AVAudioSession srg_isAirplayActive];
@@ -224,7 +275,7 @@ static void commonInit(SRGAirplayView *self);
     else {
         self.hidden = ! self.fakedForInterfaceBuilder && ! [AVAudioSession srg_isAirplayActive];
     }
-    
+
     if (wasHidden && ! self.hidden && [self.delegate respondsToSelector:@selector(airplayView:didShowWithAirplayRouteName:)]) {
         [self.delegate airplayView:self didShowWithAirplayRouteName:[AVAudioSession srg_activeAirplayRouteName]];
     }
@@ -261,21 +312,11 @@ static void commonInit(SRGAirplayView *self);
               NSParagraphStyleAttributeName: style };
 }
 
-#pragma mark Notifications
+#pragma mark SRGAirplayRouteObserver protocol
 
-- (void)srg_airplayView_wirelessRouteActiveDidChange:(NSNotification *)notification
+- (void)airplayRouteServiceDidDetectChange:(SRGAirplayRouteService *)service
 {
-    [self updateAppearance];
-}
-
-- (void)srg_airplayView_screenDidConnect:(NSNotification *)notification
-{
-    [self updateAppearance];
-}
-
-- (void)srg_airplayView_screenDidDisconnect:(NSNotification *)notification
-{
-    [self updateAppearance];
+    [self setNeedsAppearanceUpdate];
 }
 
 #pragma mark Interface Builder integration
@@ -283,7 +324,7 @@ static void commonInit(SRGAirplayView *self);
 - (void)prepareForInterfaceBuilder
 {
     [super prepareForInterfaceBuilder];
-    
+
     self.fakedForInterfaceBuilder = YES;
     [self updateAppearance];
 }
@@ -297,7 +338,6 @@ static void commonInit(SRGAirplayView *self)
     self.contentMode = UIViewContentModeRedraw;
     self.userInteractionEnabled = NO;
     self.hidden = YES;
-    self.volumeView = [[MPVolumeView alloc] init];
 }
 
 NSString * SRGAirplayRouteDescription(void)
@@ -247,8 +247,7 @@ static UIImage *SRGPictureInPictureButtonStartImage(void)
     static UIImage *s_image;
     static dispatch_once_t s_onceToken;
     dispatch_once(&s_onceToken, ^{
-        NSString *imagePath = [[NSBundle srg_mediaPlayerBundle] pathForResource:@"picture_in_picture_start_button" ofType:@"png"];
-        s_image = [[UIImage imageWithContentsOfFile:imagePath] imageWithRenderingMode:UIImageRenderingModeAlwaysTemplate];
+        s_image = [[NSBundle srg_mediaPlayerImageNamed:@"picture_in_picture_start_button"] imageWithRenderingMode:UIImageRenderingModeAlwaysTemplate];
     });
     return s_image;
 }
@@ -258,8 +257,7 @@ static UIImage *SRGPictureInPictureButtonStopImage(void)
     static UIImage *image;
     static dispatch_once_t onceToken;
     dispatch_once(&onceToken, ^{
-        NSString *imagePath = [[NSBundle srg_mediaPlayerBundle] pathForResource:@"picture_in_picture_stop_button" ofType:@"png"];
-        image = [[UIImage imageWithContentsOfFile:imagePath] imageWithRenderingMode:UIImageRenderingModeAlwaysTemplate];
+        image = [[NSBundle srg_mediaPlayerImageNamed:@"picture_in_picture_stop_button"] imageWithRenderingMode:UIImageRenderingModeAlwaysTemplate];
     });
     return image;
 }
@@ -8,6 +8,15 @@
 
 static void commonInit(SRGPlaybackActivityIndicatorView *self);
 
+@interface SRGPlaybackActivityIndicatorView ()
+
+// `YES` iff the playback state warrants the spinner. The animation is only actually started while the view can be
+// seen, Core Animation would otherwise keep compositing an invisible spinner on every frame (e.g. when the overlay
+// has been alpha-faded out by interface hiding logic)
+@property (nonatomic) BOOL shouldAnimate;
+
+@end
+
 @implementation SRGPlaybackActivityIndicatorView
 
 #pragma mark Object lifecycle
@@ -34,44 +43,66 @@ static void commonInit(SRGPlaybackActivityIndicatorView *self);
 {
     if (_mediaPlayerController) {
         [[NSNotificationCenter defaultCenter] removeObserver:self
-                                                        name:SRGMediaPlayerPlaybackStateDidChangeNotification
+                                                        name:SRGMediaPlayerBatchedPlaybackStateDidChangeNotification
                                                       object:_mediaPlayerController];
     }
-    
+
     _mediaPlayerController = mediaPlayerController;
     [self updateAppearanceForMediaPlayerController:mediaPlayerController];
-    
+
     if (mediaPlayerController) {
         [[NSNotificationCenter defaultCenter] addObserver:self
                                                  selector:@selector(updateUponPlaybackStateChange:)
-                                                     name:SRGMediaPlayerPlaybackStateDidChangeNotification
+                                                     name:SRGMediaPlayerBatchedPlaybackStateDidChangeNotification
                                                    object:mediaPlayerController];
     }
 }
 
+- (void)setShouldAnimate:(BOOL)shouldAnimate
+{
+    _shouldAnimate = shouldAnimate;
+    [self updateAnimation];
+}
+
 #pragma mark Overrides
 
-- (void)willMoveToWindow:(UIWindow *)newWindow
+- (void)didMoveToWindow
 {
-    [super willMoveToWindow:newWindow];
+    [super didMoveToWindow];
 
-    if (newWindow) {
+    if (self.window) {
         [self updateAppearanceForMediaPlayerController:self.mediaPlayerController];
     }
+    else {
+        [self updateAnimation];
+    }
+}
+
+- (void)setAlpha:(CGFloat)alpha
+{
+    [super setAlpha:alpha];
+
+    [self updateAnimation];
 }
 
 #pragma mark UI
 
 - (void)updateAppearanceForMediaPlayerController:(SRGMediaPlayerController *)mediaPlayerController
 {
-    if (mediaPlayerController.playbackState == SRGMediaPlayerPlaybackStatePlaying
-            || mediaPlayerController.playbackState == SRGMediaPlayerPlaybackStatePaused
-            || mediaPlayerController.playbackState == SRGMediaPlayerPlaybackStateEnded
-            || mediaPlayerController.playbackState == SRGMediaPlayerPlaybackStateIdle) {
-        [self stopAnimating];
+    self.shouldAnimate = ! (mediaPlayerController.playbackState == SRGMediaPlayerPlaybackStatePlaying
+                            || mediaPlayerController.playbackState == SRGMediaPlayerPlaybackStatePaused
+                            || mediaPlayerController.playbackState == SRGMediaPlayerPlaybackStateEnded
+                            || mediaPlayerController.playbackState == SRGMediaPlayerPlaybackStateIdle);
+}
+
+- (void)updateAnimation
+{
+    // The `hidden` property is managed by `hidesWhenStopped` and must not take part in the visibility decision
+    if (self.shouldAnimate && self.window && self.alpha != 0.f) {
+        [self startAnimating];
     }
     else {
-        [self startAnimating];
+        [self stopAnimating];
     }
 }
 
@@ -86,7 +86,7 @@ static void commonInit(SRGPlaybackButton *self);
     if (_mediaPlayerController) {
         [_mediaPlayerController removePeriodicTimeObserver:self.periodicTimeObserver];
         [[NSNotificationCenter defaultCenter] removeObserver:self
-                                                        name:SRGMediaPlayerPlaybackStateDidChangeNotification
+                                                        name:SRGMediaPlayerBatchedPlaybackStateDidChangeNotification
                                                       object:_mediaPlayerController];
     }
     
@@ -102,7 +102,7 @@ static void commonInit(SRGPlaybackButton *self);
         }];
         [[NSNotificationCenter defaultCenter] addObserver:self
                                                  selector:@selector(mediaPlayerPlaybackStateDidChange:)
-                                                     name:SRGMediaPlayerPlaybackStateDidChangeNotification
+                                                     name:SRGMediaPlayerBatchedPlaybackStateDidChangeNotification
                                                    object:mediaPlayerController];
     }
 }
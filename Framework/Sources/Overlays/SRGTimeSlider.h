@@ -24,6 +24,31 @@ typedef NS_ENUM(NSInteger, SRGTimeSliderLiveKnobPosition) {
     SRGTimeSliderLiveKnobPositionRight
 };
 
+/**
+ *  The way the slider track is rendered. The default mode renders the track, buffering and progress bars as plain
+ *  layers whose frames are simply moved when playback progresses, so that no Core Graphics redraw occurs during
+ *  playback. The drawing mode redraws the whole track with Core Graphics on each update and is mostly kept for
+ *  Interface Builder live rendering.
+ */
+typedef NS_ENUM(NSInteger, SRGTimeSliderRenderingMode) {
+    SRGTimeSliderRenderingModeDefault = 0,
+    SRGTimeSliderRenderingModeLayers = SRGTimeSliderRenderingModeDefault,
+    SRGTimeSliderRenderingModeDrawing
+};
+
+/**
+ *  The way the slider behaves while the user drags the knob. In the local preview mode (the default), the drag is
+ *  rendered purely from the local knob position — the stream time range is snapshotted when the drag begins, and no
+ *  player queries or seeks are performed while it lasts — with a single seek issued when the knob is released. The
+ *  live scrubbing mode issues seeks while dragging so the video follows the knob (see `seekingDuringTracking`), at
+ *  the price of in-flight seek completions competing with the knob position.
+ */
+typedef NS_ENUM(NSInteger, SRGTimeSliderTrackingMode) {
+    SRGTimeSliderTrackingModeDefault = 0,
+    SRGTimeSliderTrackingModeLocalPreview = SRGTimeSliderTrackingModeDefault,
+    SRGTimeSliderTrackingModeLiveScrubbing
+};
+
 /**
  *  A slider displaying the playback position of the associated media player controller (with optional time and remaining
  *  time labels) and providing a way to seek to any position. The slider also display which part of the media has already
@@ -108,12 +133,18 @@ IB_DESIGNABLE
 
 /**
  *  Set to `YES` to have the player seek when the slider knob is moved, or to `NO` if seeking must be performed only
- *  after the knob has been released.
+ *  after the knob has been released. Only applies in the `SRGTimeSliderTrackingModeLiveScrubbing` tracking mode,
+ *  the local preview mode never seeks during the drag.
  *
  *  Defaults to `YES`.
  */
 @property (nonatomic, getter=isSeekingDuringTracking) IBInspectable BOOL seekingDuringTracking;
 
+/**
+ *  The way the slider behaves while the knob is dragged. Defaults to `SRGTimeSliderTrackingModeDefault`.
+ */
+@property (nonatomic) SRGTimeSliderTrackingMode trackingMode;
+
 /**
  *  Set to `YES` to have the player automatically resume after a seek (if paused).
  *
@@ -126,6 +157,11 @@ IB_DESIGNABLE
  */
 @property (nonatomic) SRGTimeSliderLiveKnobPosition knobLivePosition;
 
+/**
+ *  The way the slider track is rendered. Defaults to `SRGTimeSliderRenderingModeDefault`.
+ */
+@property (nonatomic) SRGTimeSliderRenderingMode renderingMode;
+
 @end
 
 /**
@@ -143,6 +179,22 @@ IB_DESIGNABLE
  */
 - (void)timeSlider:(SRGTimeSlider *)slider isMovingToPlaybackTime:(CMTime)time withValue:(CGFloat)value interactive:(BOOL)interactive;
 
+@optional
+
+/**
+ *  Called while the user is scrubbing, with the preview frame nearest to the current knob position, served synchronously
+ *  from `SRGMediaPlayerThumbnailCache`. Use this hook to display a preview above the knob so that a scrubbing session
+ *  ends in a single final seek rather than several speculative ones.
+ *
+ *  @param slider    The slider for which the event is received.
+ *  @param thumbnail The preview frame nearest to the knob position, `nil` if none is available (hide the preview then).
+ *  @param time      The time corresponding to the knob position.
+ *
+ *  @discussion Thumbnails must have been prefetched with `-[SRGMediaPlayerThumbnailCache prefetchThumbnailsForURL:]`
+ *              beforehand, otherwise `nil` is always received.
+ */
+- (void)timeSlider:(SRGTimeSlider *)slider didScrubToThumbnail:(nullable UIImage *)thumbnail atTime:(CMTime)time;
+
 @end
 
 NS_ASSUME_NONNULL_END
@@ -7,12 +7,25 @@
 #import "SRGTimeSlider.h"
 
 #import "NSBundle+SRGMediaPlayer.h"
+#import "SRGMediaPlayerThumbnailCache.h"
+#import "SRGMediaPlayerTimeUtilities.h"
 #import "UIBezierPath+SRGMediaPlayer.h"
 
 #import <libextobjc/libextobjc.h>
 
 static void commonInit(SRGTimeSlider *self);
 
+/**
+ *  Content currently rendered by the value / time left labels, used to short-circuit formatting when a refresh
+ *  would not change the displayed text.
+ */
+typedef NS_ENUM(NSInteger, SRGTimeSliderLabelsContent) {
+    SRGTimeSliderLabelsContentNone = 0,             // Labels not rendered yet
+    SRGTimeSliderLabelsContentPlaceholder,          // Placeholder displayed while no reliable values are available
+    SRGTimeSliderLabelsContentLive,                 // Live label
+    SRGTimeSliderLabelsContentTimes                 // Elapsed / remaining times
+};
+
 // Cannot sadly use NSDateComponentsFormatter, impossible to get compact strings with different components if hours must
 // be displayed or not
 static NSString *SRGTimeSliderFormatter(NSTimeInterval seconds)
@@ -67,9 +80,30 @@ static NSString *SRGTimeSliderAccessibilityFormatter(NSTimeInterval seconds)
 @property (nonatomic) NSString *timeLeftValueString;
 @property (nonatomic) NSString *valueString;
 
+// Labels are refreshed several times per second by the periodic time observer, but their text only changes once per
+// second. Remember what has been rendered to skip formatting and label updates when the displayed second is unchanged
+@property (nonatomic) SRGTimeSliderLabelsContent renderedLabelsContent;
+@property (nonatomic) NSInteger renderedValueSecond;
+@property (nonatomic) NSInteger renderedTimeLeftSecond;
+
+// Stream time range snapshotted when a drag begins, so that the local preview tracking mode never queries the
+// player while the drag lasts
+@property (nonatomic) CMTimeRange trackingTimeRange;
+
+// Sublayers used in the layer-based rendering mode (no Core Graphics redraws during playback)
+@property (nonatomic) CALayer *barLayer;
+@property (nonatomic) CALayer *maximumTrackLayer;
+@property (nonatomic) CALayer *minimumTrackLayer;
+@property (nonatomic) NSMutableArray<CALayer *> *bufferingTrackLayers;
+
 @end
 
-@implementation SRGTimeSlider
+@implementation SRGTimeSlider {
+@private
+    // The item duration only changes on item switches or DVR window movement, no need to reconvert it on every
+    // layout pass
+    SRGMediaPlayerSecondsCache _durationSecondsCache;
+}
 
 #pragma mark Object lifecycle
 
@@ -102,7 +136,7 @@ static NSString *SRGTimeSliderAccessibilityFormatter(NSTimeInterval seconds)
         [_mediaPlayerController removePeriodicTimeObserver:self.periodicTimeObserver];
         
         [[NSNotificationCenter defaultCenter] removeObserver:self
-                                                        name:SRGMediaPlayerPlaybackStateDidChangeNotification
+                                                        name:SRGMediaPlayerBatchedPlaybackStateDidChangeNotification
                                                       object:_mediaPlayerController];
         [[NSNotificationCenter defaultCenter] removeObserver:self
                                                         name:SRGMediaPlayerSeekNotification
@@ -110,7 +144,8 @@ static NSString *SRGTimeSliderAccessibilityFormatter(NSTimeInterval seconds)
     }
     
     _mediaPlayerController = mediaPlayerController;
-    
+    self.renderedLabelsContent = SRGTimeSliderLabelsContentNone;
+
     if (mediaPlayerController) {
         @weakify(self)
         self.periodicTimeObserver = [mediaPlayerController addPeriodicTimeObserverForInterval:CMTimeMake(1., 5.) queue:NULL usingBlock:^(CMTime time) {
@@ -124,7 +159,7 @@ static NSString *SRGTimeSliderAccessibilityFormatter(NSTimeInterval seconds)
         
         [[NSNotificationCenter defaultCenter] addObserver:self
                                                  selector:@selector(srg_timeSlider_playbackStateDidChange:)
-                                                     name:SRGMediaPlayerPlaybackStateDidChangeNotification
+                                                     name:SRGMediaPlayerBatchedPlaybackStateDidChangeNotification
                                                    object:mediaPlayerController];
         [[NSNotificationCenter defaultCenter] addObserver:self
                                                  selector:@selector(srg_timeSlider_seek:)
@@ -133,6 +168,19 @@ static NSString *SRGTimeSliderAccessibilityFormatter(NSTimeInterval seconds)
     }
 }
 
+// Invalidate the rendered label state when labels are rebound, so that the next refresh renders into them
+- (void)setValueLabel:(UILabel *)valueLabel
+{
+    _valueLabel = valueLabel;
+    self.renderedLabelsContent = SRGTimeSliderLabelsContentNone;
+}
+
+- (void)setTimeLeftValueLabel:(UILabel *)timeLeftValueLabel
+{
+    _timeLeftValueLabel = timeLeftValueLabel;
+    self.renderedLabelsContent = SRGTimeSliderLabelsContentNone;
+}
+
 - (BOOL)isDraggable
 {
     // A slider knob can be dragged iff it corresponds to a valid range
@@ -142,11 +190,29 @@ static NSString *SRGTimeSliderAccessibilityFormatter(NSTimeInterval seconds)
 - (void)setBorderColor:(UIColor *)borderColor
 {
     _borderColor = borderColor ?: [UIColor blackColor];
+    [self updateRendering];
 }
 
 - (void)setBufferingTrackColor:(UIColor *)bufferingTrackColor
 {
     _bufferingTrackColor = bufferingTrackColor ?: [UIColor darkGrayColor];
+    [self updateRendering];
+}
+
+- (void)setRenderingMode:(SRGTimeSliderRenderingMode)renderingMode
+{
+    _renderingMode = renderingMode;
+
+    BOOL layersHidden = (renderingMode == SRGTimeSliderRenderingModeDrawing);
+    self.barLayer.hidden = layersHidden;
+    self.maximumTrackLayer.hidden = layersHidden;
+    self.minimumTrackLayer.hidden = layersHidden;
+    for (CALayer *layer in self.bufferingTrackLayers) {
+        layer.hidden = layersHidden;
+    }
+
+    [self setNeedsDisplay];
+    [self updateRendering];
 }
 
 // Override color properties since the default superclass behavior is to remove corresponding images, which we here
@@ -214,7 +280,7 @@ static NSString *SRGTimeSliderAccessibilityFormatter(NSTimeInterval seconds)
         self.value = 0.f;
         self.userInteractionEnabled = YES;
     }
-    else if (! CMTIMERANGE_IS_EMPTY(timeRange) && ! CMTIMERANGE_IS_INDEFINITE(timeRange) && ! CMTIMERANGE_IS_INVALID(timeRange)) {
+    else if (SRGMediaPlayerIsUsableTimeRange(timeRange)) {
         self.maximumValue = CMTimeGetSeconds(timeRange.duration);
         self.value = CMTimeGetSeconds(CMTimeSubtract(time, timeRange.start));
         self.userInteractionEnabled = YES;
@@ -230,20 +296,27 @@ static NSString *SRGTimeSliderAccessibilityFormatter(NSTimeInterval seconds)
        isMovingToPlaybackTime:time
                     withValue:self.value
                   interactive:NO];
-    
-    [self setNeedsDisplay];
+
+    [self updateRendering];
     [self updateTimeRangeLabels];
 }
 
 - (CMTime)time
 {
-    CMTimeRange timeRange = self.mediaPlayerController.timeRange;
+    // While a local preview drag is underway, derive the time from the snapshotted range instead of querying the
+    // player
+    CMTimeRange timeRange = [self isTrackingLocalPreview] ? self.trackingTimeRange : self.mediaPlayerController.timeRange;
     if (CMTIMERANGE_IS_EMPTY(timeRange)) {
         return kCMTimeZero;
     }
-    
+
     CMTime relativeTime = CMTimeMakeWithSeconds(self.value, NSEC_PER_SEC);
-    return CMTimeAdd(timeRange.start, relativeTime);
+    return SRGMediaPlayerTimeClampedToRange(CMTimeAdd(timeRange.start, relativeTime), timeRange);
+}
+
+- (BOOL)isTrackingLocalPreview
+{
+    return self.tracking && self.trackingMode == SRGTimeSliderTrackingModeLocalPreview;
 }
 
 - (NSDate *)date
@@ -258,7 +331,7 @@ static NSString *SRGTimeSliderAccessibilityFormatter(NSTimeInterval seconds)
         return [NSDate date];
     }
     else if (mediaPlayerController.streamType == SRGMediaPlayerStreamTypeDVR) {
-        return [NSDate dateWithTimeIntervalSinceNow:-CMTimeGetSeconds(CMTimeSubtract(CMTimeRangeGetEnd(timeRange), self.time))];
+        return [NSDate dateWithTimeIntervalSinceNow:-SRGMediaPlayerTimeIntervalFromRangeEnd(self.time, timeRange)];
     }
     else {
         return nil;
@@ -289,6 +362,11 @@ static NSString *SRGTimeSliderAccessibilityFormatter(NSTimeInterval seconds)
 - (void)updateTimeRangeLabels
 {
     if ([self isNotReadyToDisplayValues]) {
+        if (self.renderedLabelsContent == SRGTimeSliderLabelsContentPlaceholder) {
+            return;
+        }
+        self.renderedLabelsContent = SRGTimeSliderLabelsContentPlaceholder;
+
         self.valueString = @"--:--";
         self.valueString.accessibilityLabel = nil;
         self.timeLeftValueString = @"--:--";
@@ -297,20 +375,37 @@ static NSString *SRGTimeSliderAccessibilityFormatter(NSTimeInterval seconds)
         self.timeLeftValueLabel.text = self.timeLeftValueString;
         return;
     }
-    
+
     if (self.live) {
+        if (self.renderedLabelsContent == SRGTimeSliderLabelsContentLive) {
+            return;
+        }
+        self.renderedLabelsContent = SRGTimeSliderLabelsContentLive;
+
         self.valueString = @"--:--";
         self.valueString.accessibilityLabel = nil;
         self.timeLeftValueString = SRGMediaPlayerLocalizedString(@"Live", @"Very short text on left time label when playing a live stream");
         self.timeLeftValueString.accessibilityLabel = nil;
     }
     else {
+        // Displayed strings only have second precision. Skip formatting entirely when the rounded second is unchanged
+        NSInteger valueSecond = (NSInteger)round(self.value);
+        NSInteger timeLeftSecond = (NSInteger)round(self.value - self.maximumValue);
+        if (self.renderedLabelsContent == SRGTimeSliderLabelsContentTimes
+                && self.renderedValueSecond == valueSecond
+                && self.renderedTimeLeftSecond == timeLeftSecond) {
+            return;
+        }
+        self.renderedLabelsContent = SRGTimeSliderLabelsContentTimes;
+        self.renderedValueSecond = valueSecond;
+        self.renderedTimeLeftSecond = timeLeftSecond;
+
         self.valueString = SRGTimeSliderFormatter(self.value);
         self.valueString.accessibilityLabel = [NSString stringWithFormat:SRGMediaPlayerAccessibilityLocalizedString(@"%@ played", @"Label on slider for time elapsed"), SRGTimeSliderAccessibilityFormatter(self.value)];
         self.timeLeftValueString = SRGTimeSliderFormatter(self.value - self.maximumValue);
         self.timeLeftValueString.accessibilityLabel = [NSString stringWithFormat:SRGMediaPlayerAccessibilityLocalizedString(@"%@ remaining", @"Label on slider for time remaining"), SRGTimeSliderAccessibilityFormatter(self.value - self.maximumValue)];
     }
-    
+
     self.valueLabel.text = self.valueString;
     self.valueLabel.accessibilityLabel = self.valueString.accessibilityLabel;
     self.timeLeftValueLabel.text = self.timeLeftValueString;
@@ -325,7 +420,11 @@ static NSString *SRGTimeSliderAccessibilityFormatter(NSTimeInterval seconds)
     if (! beginTracking || ! [self isDraggable]) {
         return NO;
     }
-    
+
+    // Snapshot the time range once. The drag is then rendered from purely local values in the local preview
+    // tracking mode
+    self.trackingTimeRange = self.mediaPlayerController.timeRange;
+
     return beginTracking;
 }
 
@@ -335,12 +434,12 @@ static NSString *SRGTimeSliderAccessibilityFormatter(NSTimeInterval seconds)
     
     if (continueTracking && [self isDraggable]) {
         [self updateTimeRangeLabels];
-        [self setNeedsDisplay];
+        [self updateRendering];
     }
     
     CMTime time = self.time;
-    
-    if (self.seekingDuringTracking) {
+
+    if (self.trackingMode == SRGTimeSliderTrackingModeLiveScrubbing && self.seekingDuringTracking) {
         [self.mediaPlayerController seekEfficientlyToTime:time withCompletionHandler:nil];
     }
     
@@ -349,7 +448,12 @@ static NSString *SRGTimeSliderAccessibilityFormatter(NSTimeInterval seconds)
               isMovingToPlaybackTime:time
                            withValue:self.value
                          interactive:YES];
-    
+
+    if ([self.delegate respondsToSelector:@selector(timeSlider:didScrubToThumbnail:atTime:)]) {
+        UIImage *thumbnail = [[SRGMediaPlayerThumbnailCache sharedThumbnailCache] thumbnailForURL:self.mediaPlayerController.contentURL atTime:time];
+        [self.delegate timeSlider:self didScrubToThumbnail:thumbnail atTime:time];
+    }
+
     return continueTracking;
 }
 
@@ -386,12 +490,114 @@ static NSString *SRGTimeSliderAccessibilityFormatter(NSTimeInterval seconds)
     return [path srg_imageWithColor:self.thumbTintColor];
 }
 
+#pragma mark Rendering
+
+- (void)updateRendering
+{
+    if (self.renderingMode == SRGTimeSliderRenderingModeDrawing) {
+        [self setNeedsDisplay];
+    }
+    else {
+        [self updateTrackLayers];
+    }
+}
+
+- (void)layoutSubviews
+{
+    [super layoutSubviews];
+
+    [self updateRendering];
+}
+
+#pragma mark Layer-based rendering
+
+// Mirrors the Core Graphics drawing code below, but only mutates plain layer frames, which is cheap enough to be
+// performed on every playback tick
+- (void)updateTrackLayers
+{
+    if (self.renderingMode == SRGTimeSliderRenderingModeDrawing) {
+        return;
+    }
+
+    [CATransaction begin];
+    [CATransaction setDisableActions:YES];
+
+    CGRect trackFrame = [self trackRectForBounds:self.bounds];
+    CGFloat midY = CGRectGetMidY(self.bounds);
+
+    self.barLayer.backgroundColor = self.borderColor.CGColor;
+    self.barLayer.frame = CGRectMake(CGRectGetMinX(trackFrame),
+                                     midY - 1.5f,
+                                     fmax(CGRectGetWidth(trackFrame) - CGRectGetMinX(trackFrame), 0.f),
+                                     3.f);
+
+    self.maximumTrackLayer.backgroundColor = self.maximumTrackTintColor.CGColor;
+    self.maximumTrackLayer.frame = CGRectMake(CGRectGetMinX(trackFrame) + 2.f,
+                                              midY - 0.5f,
+                                              fmax(CGRectGetMaxX(trackFrame) - CGRectGetMinX(trackFrame) - 4.f, 0.f),
+                                              1.f);
+
+    [self updateBufferingTrackLayersWithTrackFrame:trackFrame];
+
+    CGRect barFrame = [self minimumValueImageRectForBounds:self.bounds];
+    self.minimumTrackLayer.backgroundColor = self.minimumTrackTintColor.CGColor;
+    self.minimumTrackLayer.frame = CGRectMake(CGRectGetMinX(barFrame) - 0.5f,
+                                              midY - 1.5f,
+                                              fmax(CGRectGetWidth(barFrame) - CGRectGetMinX(barFrame) + 0.5f, 0.f),
+                                              3.f);
+
+    [CATransaction commit];
+}
+
+- (void)updateBufferingTrackLayersWithTrackFrame:(CGRect)trackFrame
+{
+    // Buffering information is secondary during a local preview drag, leave the layers as they are rather than
+    // querying the player item on every touch move
+    if ([self isTrackingLocalPreview]) {
+        return;
+    }
+
+    NSArray<NSValue *> *loadedTimeRanges = self.mediaPlayerController.player.currentItem.loadedTimeRanges;
+
+    // Adjust the layer pool to the number of ranges to display (usually one or two)
+    while (self.bufferingTrackLayers.count < loadedTimeRanges.count) {
+        CALayer *layer = [CALayer layer];
+        [self.layer insertSublayer:layer above:self.maximumTrackLayer];
+        [self.bufferingTrackLayers addObject:layer];
+    }
+    while (self.bufferingTrackLayers.count > loadedTimeRanges.count) {
+        [self.bufferingTrackLayers.lastObject removeFromSuperlayer];
+        [self.bufferingTrackLayers removeLastObject];
+    }
+
+    CGFloat duration = SRGMediaPlayerSecondsCached(self.mediaPlayerController.player.currentItem.duration, &self->_durationSecondsCache);
+
+    [loadedTimeRanges enumerateObjectsUsingBlock:^(NSValue * _Nonnull value, NSUInteger idx, BOOL * _Nonnull stop) {
+        CALayer *layer = self.bufferingTrackLayers[idx];
+        layer.backgroundColor = self.bufferingTrackColor.CGColor;
+
+        if (isnan(duration) || duration == 0.) {
+            layer.frame = CGRectZero;
+            return;
+        }
+
+        CMTimeRange timeRange = [value CMTimeRangeValue];
+        CGFloat minX = CGRectGetWidth(trackFrame) / duration * CMTimeGetSeconds(timeRange.start);
+        CGFloat maxX = CGRectGetWidth(trackFrame) / duration * (CMTimeGetSeconds(timeRange.start) + CMTimeGetSeconds(timeRange.duration));
+        layer.frame = CGRectMake(minX, CGRectGetMidY(self.bounds) - 0.5f, fmax(maxX - minX, 0.f), 1.f);
+    }];
+}
+
 #pragma mark Drawing
 
 - (void)drawRect:(CGRect)rect
 {
     [super drawRect:rect];
-    
+
+    if (self.renderingMode != SRGTimeSliderRenderingModeDrawing) {
+        return;
+    }
+
     CGContextRef context = UIGraphicsGetCurrentContext();
     [self drawBar:context];
     [self drawMaximumTrack:context];
@@ -435,7 +641,7 @@ static NSString *SRGTimeSliderAccessibilityFormatter(NSTimeInterval seconds)
 {
     CGFloat lineWidth = 1.f;
     
-    CGFloat duration = CMTimeGetSeconds(self.mediaPlayerController.player.currentItem.duration);
+    CGFloat duration = SRGMediaPlayerSecondsCached(self.mediaPlayerController.player.currentItem.duration, &_durationSecondsCache);
     if (isnan(duration)) {
         return;
     }
@@ -484,8 +690,8 @@ static NSString *SRGTimeSliderAccessibilityFormatter(NSTimeInterval seconds)
         self.maximumValue = value;
         
         [self.delegate timeSlider:self isMovingToPlaybackTime:self.time withValue:self.value interactive:NO];
-        
-        [self setNeedsDisplay];
+
+        [self updateRendering];
         [self updateTimeRangeLabels];
     }
 }
@@ -536,7 +742,9 @@ static NSString *SRGTimeSliderAccessibilityFormatter(NSTimeInterval seconds)
 - (void)prepareForInterfaceBuilder
 {
     [super prepareForInterfaceBuilder];
-    
+
+    // Live rendering in Interface Builder requires the Core Graphics path
+    self.renderingMode = SRGTimeSliderRenderingModeDrawing;
     [self setNeedsDisplay];
 }
 
@@ -546,6 +754,21 @@ static NSString *SRGTimeSliderAccessibilityFormatter(NSTimeInterval seconds)
 
 static void commonInit(SRGTimeSlider *self)
 {
+    // Install the track sublayers used by the layer-based rendering mode. Rounded corners mimic the round line caps
+    // of the Core Graphics path
+    self.barLayer = [CALayer layer];
+    self.barLayer.cornerRadius = 1.5f;
+    [self.layer addSublayer:self.barLayer];
+
+    self.maximumTrackLayer = [CALayer layer];
+    [self.layer addSublayer:self.maximumTrackLayer];
+
+    self.minimumTrackLayer = [CALayer layer];
+    self.minimumTrackLayer.cornerRadius = 1.5f;
+    [self.layer addSublayer:self.minimumTrackLayer];
+
+    self.bufferingTrackLayers = [NSMutableArray array];
+
     // Apply default colors
     self.borderColor = nil;
     self.bufferingTrackColor = nil;
@@ -564,5 +787,6 @@ static void commonInit(SRGTimeSlider *self)
     [self setThumbImage:[self thumbImage] forState:UIControlStateHighlighted];
     
     self.seekingDuringTracking = YES;
+    self.trackingMode = SRGTimeSliderTrackingModeDefault;
     self.knobLivePosition = SRGTimeSliderLiveKnobPositionLeft;
 }
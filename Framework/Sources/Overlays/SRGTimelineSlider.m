@@ -7,9 +7,46 @@
 #import "SRGTimelineSlider.h"
 
 #import "NSBundle+SRGMediaPlayer.h"
+#import "SRGMediaPlayerTimeUtilities.h"
 
 static void commonInit(SRGTimelineSlider *self);
 
+// Default tick displayed for segments without a delegate-supplied icon, rasterized once per screen scale. The image
+// is slightly larger than the tick so that the 1-point border stroke is not clipped
+static UIImage *SRGTimelineSliderTickImage(void)
+{
+    static UIImage *s_tickImage;
+    static dispatch_once_t s_onceToken;
+    dispatch_once(&s_onceToken, ^{
+        static const CGFloat kTickWidth = 3.f;
+        static const CGFloat kTickHeight = 19.f;
+
+        CGSize size = CGSizeMake(kTickWidth + 1.f, kTickHeight + 1.f);
+        UIGraphicsBeginImageContextWithOptions(size, NO, 0.f);
+
+        CGContextRef context = UIGraphicsGetCurrentContext();
+        CGContextSetLineWidth(context, 1.f);
+        CGContextSetStrokeColorWithColor(context, [UIColor blackColor].CGColor);
+        CGContextSetFillColorWithColor(context, [UIColor whiteColor].CGColor);
+
+        UIBezierPath *path = [UIBezierPath bezierPathWithRect:CGRectMake(0.5f, 0.5f, kTickWidth, kTickHeight)];
+        [path fill];
+        [path stroke];
+
+        s_tickImage = UIGraphicsGetImageFromCurrentImageContext();
+        UIGraphicsEndImageContext();
+    });
+    return s_tickImage;
+}
+
+@interface SRGTimelineSlider ()
+
+// Offscreen-prepared strip holding all segment icons, so that scrubbing does not re-render each icon on every frame
+@property (nonatomic) UIImage *iconStripImage;
+@property (nonatomic) CMTimeRange iconStripTimeRange;
+
+@end
+
 @implementation SRGTimelineSlider
 
 #pragma mark Object lifecycle
@@ -47,11 +84,28 @@ static void commonInit(SRGTimelineSlider *self);
         return;
     }
 
-    CGContextRef context = UIGraphicsGetCurrentContext();
+    // Icon positions only depend on the bounds and the stream time range. Render all icons into an offscreen strip
+    // once, and simply blit it on subsequent passes (e.g. while scrubbing)
+    if (! self.iconStripImage
+            || ! CGSizeEqualToSize(self.iconStripImage.size, self.bounds.size)
+            || ! CMTimeRangeEqual(self.iconStripTimeRange, timeRange)) {
+        self.iconStripImage = [self iconStripImageWithTimeRange:timeRange];
+        self.iconStripTimeRange = timeRange;
+    }
+
+    [self.iconStripImage drawAtPoint:CGPointZero];
+}
 
-    CGRect trackRect = [self trackRectForBounds:rect];
-    CGFloat thumbStartXPos = CGRectGetMidX([self thumbRectForBounds:rect trackRect:trackRect value:self.minimumValue]);
-    CGFloat thumbEndXPos = CGRectGetMidX([self thumbRectForBounds:rect trackRect:trackRect value:self.maximumValue]);
+#pragma mark Icon strip
+
+- (UIImage *)iconStripImageWithTimeRange:(CMTimeRange)timeRange
+{
+    CGRect bounds = self.bounds;
+    UIGraphicsBeginImageContextWithOptions(bounds.size, NO, 0.f);
+
+    CGRect trackRect = [self trackRectForBounds:bounds];
+    CGFloat thumbStartXPos = CGRectGetMidX([self thumbRectForBounds:bounds trackRect:trackRect value:self.minimumValue]);
+    CGFloat thumbEndXPos = CGRectGetMidX([self thumbRectForBounds:bounds trackRect:trackRect value:self.maximumValue]);
 
     for (id<SRGSegment> segment in self.mediaPlayerController.visibleSegments) {
         // Skip events not in the timeline
@@ -60,7 +114,7 @@ static void commonInit(SRGTimelineSlider *self);
             continue;
         }
 
-        CGFloat tickXPos = thumbStartXPos + (CMTimeGetSeconds(segment.srg_timeRange.start) / CMTimeGetSeconds(timeRange.duration)) * (thumbEndXPos - thumbStartXPos);
+        CGFloat tickXPos = thumbStartXPos + SRGMediaPlayerTimeFractionForRange(segment.srg_timeRange.start, timeRange) * (thumbEndXPos - thumbStartXPos);
 
         UIImage *iconImage = nil;
         if ([self.timelineSliderDelegate respondsToSelector:@selector(timelineSlider:iconImageForSegment:)]) {
@@ -77,28 +131,23 @@ static void commonInit(SRGTimelineSlider *self);
             [iconImage drawInRect:tickRect];
         }
         else {
-            static const CGFloat kTickWidth = 3.f;
-            CGFloat tickHeight = 19.f;
-
-            CGContextSetLineWidth(context, 1.f);
-            CGContextSetStrokeColorWithColor(context, [UIColor blackColor].CGColor);
-            CGContextSetFillColorWithColor(context, [UIColor whiteColor].CGColor);
-
-            CGRect tickRect = CGRectMake(tickXPos - kTickWidth / 2.f,
-                                         CGRectGetMidY(trackRect) - tickHeight / 2.f,
-                                         kTickWidth,
-                                         tickHeight);
-            UIBezierPath *path = [UIBezierPath bezierPathWithRect:tickRect];
-            [path fill];
-            [path stroke];
+            UIImage *tickImage = SRGTimelineSliderTickImage();
+            [tickImage drawAtPoint:CGPointMake(tickXPos - tickImage.size.width / 2.f,
+                                               CGRectGetMidY(trackRect) - tickImage.size.height / 2.f)];
         }
     }
+
+    UIImage *image = UIGraphicsGetImageFromCurrentImageContext();
+    UIGraphicsEndImageContext();
+    return image;
 }
 
 #pragma mark Data
 
 - (void)reloadData
 {
+    // Invalidate the prepared icon strip, it will be rebuilt on the next drawing pass
+    self.iconStripImage = nil;
     [self setNeedsDisplay];
 }
 
@@ -124,8 +173,7 @@ static void commonInit(SRGTimelineSlider *self);
 
 static void commonInit(SRGTimelineSlider *self)
 {
-    NSString *thumbImagePath = [[NSBundle srg_mediaPlayerBundle] pathForResource:@"thumb_timeline_slider" ofType:@"png"];
-    UIImage *thumbImage = [UIImage imageWithContentsOfFile:thumbImagePath];
+    UIImage *thumbImage = [NSBundle srg_mediaPlayerImageNamed:@"thumb_timeline_slider"];
     [self setThumbImage:thumbImage forState:UIControlStateNormal];
     [self setThumbImage:thumbImage forState:UIControlStateHighlighted];
 
@@ -58,10 +58,19 @@ IB_DESIGNABLE
 - (void)registerNib:(UINib *)nib forCellWithReuseIdentifier:(NSString *)identifier;
 
 /**
- *  Trigger a reload of the timeline based on the non-hidden segments available from the media player controller.
+ *  Trigger a full reload of the timeline based on the non-hidden segments available from the media player controller.
  */
 - (void)reloadData;
 
+/**
+ *  Update the timeline based on the non-hidden segments available from the media player controller, diffing them
+ *  against the currently displayed list and applying incremental collection updates (insertions, deletions and moves)
+ *  only. Unlike `-reloadData`, cells for unchanged segments are left untouched and the scroll position is preserved,
+ *  which makes this method suitable for periodically growing timelines (e.g. live streams). Falls back to a full
+ *  reload when the timeline is not displayed yet.
+ */
+- (void)updateData;
+
 /**
  *  Dequeue a reusable cell for a given segment.
  *
@@ -100,6 +109,27 @@ IB_DESIGNABLE
 
 @optional
 
+/**
+ *  Return the cell width to use for a segment. When implemented, this method replaces the uniform `itemWidth`
+ *  setting. It is only called once per segment, computed widths are cached by the timeline until the data is
+ *  reloaded, so implementations can measure content (e.g. title text) without hurting scrolling performance.
+ */
+- (CGFloat)timelineView:(SRGTimelineView *)timelineView widthForSegment:(id<SRGSegment>)segment;
+
+/**
+ *  Called ahead of time for segments whose cells are likely to be displayed soon (see
+ *  `UICollectionViewDataSourcePrefetching`). Use this hook to pre-decode segment thumbnails or warm other caches,
+ *  so that fast timeline swipes do not drop frames when the cells appear. Never called on devices running iOS
+ *  versions without collection view prefetching support.
+ */
+- (void)timelineView:(SRGTimelineView *)timelineView prefetchSegments:(NSArray<id<SRGSegment>> *)segments;
+
+/**
+ *  Called when previously requested prefetching work is not needed anymore (e.g. because the scrolling direction
+ *  changed).
+ */
+- (void)timelineView:(SRGTimelineView *)timelineView cancelPrefetchingForSegments:(NSArray<id<SRGSegment>> *)segments;
+
 /**
  *  Called when the user selects a segment from the timeline.
  */
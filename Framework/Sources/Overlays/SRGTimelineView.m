@@ -12,10 +12,18 @@
 
 static void commonInit(SRGTimelineView *self);
 
-@interface SRGTimelineView ()
+@interface SRGTimelineView () <UICollectionViewDataSourcePrefetching, UICollectionViewDelegateFlowLayout>
 
 @property (nonatomic, weak) UICollectionView *collectionView;
 
+// Snapshot of the visible segments currently displayed by the collection, used as data source so that incremental
+// updates can be diffed against a consistent previous state
+@property (nonatomic) NSArray<id<SRGSegment>> *displayedSegments;
+@property (nonatomic) NSMapTable<id<SRGSegment>, NSNumber *> *displayedIndexesBySegment;
+
+// Cell widths computed by the delegate, cached per segment so that scrolling does not measure cells again
+@property (nonatomic) NSMapTable<id<SRGSegment>, NSNumber *> *cachedWidthsBySegment;
+
 @end
 
 @implementation SRGTimelineView
@@ -46,6 +54,13 @@ static void commonInit(SRGTimelineView *self);
     [self reloadData];
 }
 
+// Cached widths depend on the delegate implementation, discard them when it changes
+- (void)setDelegate:(id<SRGTimelineViewDelegate>)delegate
+{
+    _delegate = delegate;
+    [self.cachedWidthsBySegment removeAllObjects];
+}
+
 - (void)setItemWidth:(CGFloat)itemWidth
 {
     _itemWidth = itemWidth;
@@ -58,6 +73,24 @@ static void commonInit(SRGTimelineView *self);
     [self layoutIfNeeded];
 }
 
+- (void)setDisplayedSegments:(NSArray<id<SRGSegment>> *)displayedSegments
+{
+    _displayedSegments = displayedSegments;
+
+    NSMapTable<id<SRGSegment>, NSNumber *> *displayedIndexesBySegment = [NSMapTable mapTableWithKeyOptions:NSPointerFunctionsObjectPointerPersonality | NSPointerFunctionsWeakMemory
+                                                                                              valueOptions:NSPointerFunctionsStrongMemory];
+    [displayedSegments enumerateObjectsUsingBlock:^(id<SRGSegment> _Nonnull segment, NSUInteger idx, BOOL * _Nonnull stop) {
+        [displayedIndexesBySegment setObject:@(idx) forKey:segment];
+    }];
+    self.displayedIndexesBySegment = displayedIndexesBySegment;
+}
+
+- (NSUInteger)displayedIndexOfSegment:(id<SRGSegment>)segment
+{
+    NSNumber *index = [self.displayedIndexesBySegment objectForKey:segment];
+    return index ? index.unsignedIntegerValue : NSNotFound;
+}
+
 #pragma mark Overrides
 
 - (void)willMoveToWindow:(UIWindow *)newWindow
@@ -93,7 +126,7 @@ static void commonInit(SRGTimelineView *self);
 
 - (id)dequeueReusableCellWithReuseIdentifier:(NSString *)identifier forSegment:(id<SRGSegment>)segment
 {
-    NSInteger index = [self.mediaPlayerController.visibleSegments indexOfObject:segment];
+    NSInteger index = [self displayedIndexOfSegment:segment];
     NSAssert(index != NSNotFound, @"The segment must be found");
     NSIndexPath *indexPath = [NSIndexPath indexPathForRow:index inSection:0];
     return [self.collectionView dequeueReusableCellWithReuseIdentifier:identifier forIndexPath:indexPath];
@@ -103,27 +136,125 @@ static void commonInit(SRGTimelineView *self);
 
 - (void)reloadData
 {
+    self.displayedSegments = self.mediaPlayerController.visibleSegments;
+    [self.cachedWidthsBySegment removeAllObjects];
     [self.collectionView reloadData];
 }
 
+- (void)updateData
+{
+    NSArray<id<SRGSegment>> *previousSegments = self.displayedSegments ?: @[];
+    NSArray<id<SRGSegment>> *segments = self.mediaPlayerController.visibleSegments ?: @[];
+
+    // Batch updates on a collection which has never been displayed are unreliable. Nothing to preserve in such
+    // cases anyway
+    if (! self.window || previousSegments.count == 0) {
+        [self reloadData];
+        return;
+    }
+
+    NSHashTable<id<SRGSegment>> *segmentsTable = [NSHashTable hashTableWithOptions:NSPointerFunctionsObjectPointerPersonality | NSPointerFunctionsWeakMemory];
+    for (id<SRGSegment> segment in segments) {
+        [segmentsTable addObject:segment];
+    }
+
+    NSMutableArray<NSIndexPath *> *deletedIndexPaths = [NSMutableArray array];
+    [previousSegments enumerateObjectsUsingBlock:^(id<SRGSegment> _Nonnull segment, NSUInteger idx, BOOL * _Nonnull stop) {
+        if (! [segmentsTable containsObject:segment]) {
+            [deletedIndexPaths addObject:[NSIndexPath indexPathForRow:idx inSection:0]];
+        }
+    }];
+
+    NSMutableArray<NSIndexPath *> *insertedIndexPaths = [NSMutableArray array];
+    NSMutableDictionary<NSIndexPath *, NSIndexPath *> *movedIndexPaths = [NSMutableDictionary dictionary];
+    [segments enumerateObjectsUsingBlock:^(id<SRGSegment> _Nonnull segment, NSUInteger idx, BOOL * _Nonnull stop) {
+        NSUInteger previousIndex = [self displayedIndexOfSegment:segment];
+        if (previousIndex == NSNotFound) {
+            [insertedIndexPaths addObject:[NSIndexPath indexPathForRow:idx inSection:0]];
+        }
+        else if (previousIndex != idx) {
+            movedIndexPaths[[NSIndexPath indexPathForRow:previousIndex inSection:0]] = [NSIndexPath indexPathForRow:idx inSection:0];
+        }
+    }];
+
+    [self.collectionView performBatchUpdates:^{
+        self.displayedSegments = segments;
+
+        [self.collectionView deleteItemsAtIndexPaths:deletedIndexPaths];
+        [self.collectionView insertItemsAtIndexPaths:insertedIndexPaths];
+        [movedIndexPaths enumerateKeysAndObjectsUsingBlock:^(NSIndexPath * _Nonnull fromIndexPath, NSIndexPath * _Nonnull toIndexPath, BOOL * _Nonnull stop) {
+            [self.collectionView moveItemAtIndexPath:fromIndexPath toIndexPath:toIndexPath];
+        }];
+    } completion:nil];
+}
+
 #pragma mark UICollectionViewDataSource protocol
 
 - (NSInteger)collectionView:(UICollectionView *)collectionView numberOfItemsInSection:(NSInteger)section
 {
-    return self.mediaPlayerController.visibleSegments.count;
+    return self.displayedSegments.count;
 }
 
 - (UICollectionViewCell *)collectionView:(UICollectionView *)collectionView cellForItemAtIndexPath:(NSIndexPath *)indexPath
 {
-    id<SRGSegment> segment = self.mediaPlayerController.visibleSegments[indexPath.row];
+    id<SRGSegment> segment = self.displayedSegments[indexPath.row];
     return [self.delegate timelineView:self cellForSegment:segment];
 }
 
+#pragma mark UICollectionViewDataSourcePrefetching protocol
+
+- (void)collectionView:(UICollectionView *)collectionView prefetchItemsAtIndexPaths:(NSArray<NSIndexPath *> *)indexPaths
+{
+    if (! [self.delegate respondsToSelector:@selector(timelineView:prefetchSegments:)]) {
+        return;
+    }
+    [self.delegate timelineView:self prefetchSegments:[self segmentsAtIndexPaths:indexPaths]];
+}
+
+- (void)collectionView:(UICollectionView *)collectionView cancelPrefetchingForItemsAtIndexPaths:(NSArray<NSIndexPath *> *)indexPaths
+{
+    if (! [self.delegate respondsToSelector:@selector(timelineView:cancelPrefetchingForSegments:)]) {
+        return;
+    }
+    [self.delegate timelineView:self cancelPrefetchingForSegments:[self segmentsAtIndexPaths:indexPaths]];
+}
+
+- (NSArray<id<SRGSegment>> *)segmentsAtIndexPaths:(NSArray<NSIndexPath *> *)indexPaths
+{
+    NSMutableArray<id<SRGSegment>> *segments = [NSMutableArray array];
+    for (NSIndexPath *indexPath in indexPaths) {
+        // Prefetch requests are delivered asynchronously and might outlive a data update
+        if (indexPath.row < self.displayedSegments.count) {
+            [segments addObject:self.displayedSegments[indexPath.row]];
+        }
+    }
+    return [segments copy];
+}
+
+#pragma mark UICollectionViewDelegateFlowLayout protocol
+
+- (CGSize)collectionView:(UICollectionView *)collectionView layout:(UICollectionViewLayout *)collectionViewLayout sizeForItemAtIndexPath:(NSIndexPath *)indexPath
+{
+    CGFloat height = CGRectGetHeight(self.collectionView.frame);
+
+    if (! [self.delegate respondsToSelector:@selector(timelineView:widthForSegment:)]) {
+        return CGSizeMake(self.itemWidth, height);
+    }
+
+    id<SRGSegment> segment = self.displayedSegments[indexPath.row];
+    NSNumber *cachedWidth = [self.cachedWidthsBySegment objectForKey:segment];
+    if (! cachedWidth) {
+        cachedWidth = @([self.delegate timelineView:self widthForSegment:segment]);
+        [self.cachedWidthsBySegment setObject:cachedWidth forKey:segment];
+    }
+    return CGSizeMake(cachedWidth.floatValue, height);
+}
+
 #pragma mark UICollectionViewDelegate protocol
 
 - (void)collectionView:(UICollectionView *)collectionView didSelectItemAtIndexPath:(NSIndexPath *)indexPath
 {
-    id<SRGSegment> segment = self.mediaPlayerController.visibleSegments[indexPath.row];
+    id<SRGSegment> segment = self.displayedSegments[indexPath.row];
     [self.mediaPlayerController seekToSegment:segment withCompletionHandler:nil];
     
     if ([self.delegate respondsToSelector:@selector(timelineView:didSelectSegmentAtIndexPath:)]) {
@@ -155,7 +286,7 @@ static void commonInit(SRGTimelineView *self);
         return;
     }
     
-    NSInteger segmentIndex = [self.mediaPlayerController.visibleSegments indexOfObject:segment];
+    NSInteger segmentIndex = [self displayedIndexOfSegment:segment];
     if (segmentIndex == NSNotFound) {
         return;
     }
@@ -195,8 +326,17 @@ static void commonInit(SRGTimelineView *self)
     collectionView.alwaysBounceHorizontal = YES;
     collectionView.dataSource = self;
     collectionView.delegate = self;
+
+    // Collection view prefetching is not available on all supported iOS versions
+    if ([collectionView respondsToSelector:@selector(setPrefetchDataSource:)]) {
+        collectionView.prefetchDataSource = self;
+    }
+
     [self addSubview:collectionView];
     self.collectionView = collectionView;
+
+    self.cachedWidthsBySegment = [NSMapTable mapTableWithKeyOptions:NSPointerFunctionsObjectPointerPersonality | NSPointerFunctionsWeakMemory
+                                                       valueOptions:NSPointerFunctionsStrongMemory];
     
     // Remove implicit constraints for views managed by autolayout
     collectionView.translatesAutoresizingMaskIntoConstraints = NO;
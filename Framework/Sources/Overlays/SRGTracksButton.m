@@ -60,17 +60,24 @@ static UIImage *SRGSelectedSubtitlesButtonImage(void);
 {
     if (_mediaPlayerController) {
         [_mediaPlayerController removeObserver:self keyPath:@keypath(_mediaPlayerController.playbackState)];
+        [[NSNotificationCenter defaultCenter] removeObserver:self
+                                                        name:SRGMediaPlayerMediaSelectionGroupsDidBecomeAvailableNotification
+                                                      object:_mediaPlayerController];
     }
-    
+
     _mediaPlayerController = mediaPlayerController;
     [self updateAppearanceForMediaPlayerController:mediaPlayerController];
-    
+
     if (mediaPlayerController) {
         @weakify(self)
         [mediaPlayerController addObserver:self keyPath:@keypath(mediaPlayerController.playbackState) options:0 block:^(MAKVONotification *notification) {
             @strongify(self)
             [self updateAppearance];
         }];
+        [[NSNotificationCenter defaultCenter] addObserver:self
+                                                 selector:@selector(srg_tracksButton_mediaSelectionGroupsDidBecomeAvailable:)
+                                                     name:SRGMediaPlayerMediaSelectionGroupsDidBecomeAvailableNotification
+                                                   object:mediaPlayerController];
     }
 }
 
@@ -140,15 +147,16 @@ static UIImage *SRGSelectedSubtitlesButtonImage(void);
     if (self.alwaysHidden) {
         self.hidden = YES;
     }
-    // Do not check tracks before the player item is ready to play (otherwise AVPlayer will internally wait on semaphores,
-    // locking the main thread).
+    // Only read the media selection groups cached by the controller. Reading them from the asset would block the
+    // main thread until its media selection data has been loaded (the button stays hidden and appears when the
+    // groups become available)
     else if (playerItem && playerItem.status == AVPlayerItemStatusReadyToPlay) {
         // Get available subtitles. If no one, the button disappears or disable. if one or more, display the button. If
         // one of subtitles is displayed, set the button in the selected state.
-        AVMediaSelectionGroup *legibleGroup = [playerItem.asset mediaSelectionGroupForMediaCharacteristic:AVMediaCharacteristicLegible];
+        AVMediaSelectionGroup *legibleGroup = [mediaPlayerController mediaSelectionGroupForMediaCharacteristic:AVMediaCharacteristicLegible];
         NSArray<AVMediaSelectionOption *> *legibleOptions = legibleGroup.options;
-        
-        AVMediaSelectionGroup *audibleGroup = [playerItem.asset mediaSelectionGroupForMediaCharacteristic:AVMediaCharacteristicAudible];
+
+        AVMediaSelectionGroup *audibleGroup = [mediaPlayerController mediaSelectionGroupForMediaCharacteristic:AVMediaCharacteristicAudible];
         NSArray<AVMediaSelectionOption *> *audibleOptions = audibleGroup.options;
         
         if (legibleOptions.count != 0 || audibleOptions.count > 1) {
@@ -171,6 +179,13 @@ static UIImage *SRGSelectedSubtitlesButtonImage(void);
     }
 }
 
+#pragma mark Notifications
+
+- (void)srg_tracksButton_mediaSelectionGroupsDidBecomeAvailable:(NSNotification *)notification
+{
+    [self updateAppearance];
+}
+
 #pragma mark SRGAlternateTracksViewControllerDelegate protocol
 
 - (void)alternateTracksViewController:(SRGAlternateTracksViewController *)alternateTracksViewController didSelectMediaOption:(AVMediaSelectionOption *)option inGroup:(AVMediaSelectionGroup *)group
@@ -194,8 +209,8 @@ static UIImage *SRGSelectedSubtitlesButtonImage(void);
 
 - (void)showSubtitlesMenu:(id)sender
 {
-    UINavigationController *navigationController = [SRGAlternateTracksViewController alternateTracksNavigationControllerForPlayer:self.mediaPlayerController.player
-                                                                                                                     withDelegate:self];
+    UINavigationController *navigationController = [SRGAlternateTracksViewController alternateTracksNavigationControllerForMediaPlayerController:self.mediaPlayerController
+                                                                                                                                    withDelegate:self];
     navigationController.modalPresentationStyle = UIModalPresentationPopover;
     
     navigationController.popoverPresentationController.delegate = self;
@@ -273,8 +288,7 @@ static UIImage *SRGTracksButtonImage(void)
     static UIImage *image;
     static dispatch_once_t onceToken;
     dispatch_once(&onceToken, ^{
-        NSString *imagePath = [[NSBundle srg_mediaPlayerBundle] pathForResource:@"alternate_tracks_button" ofType:@"png"];
-        image = [[UIImage imageWithContentsOfFile:imagePath] imageWithRenderingMode:UIImageRenderingModeAlwaysTemplate];
+        image = [[NSBundle srg_mediaPlayerImageNamed:@"alternate_tracks_button"] imageWithRenderingMode:UIImageRenderingModeAlwaysTemplate];
     });
     return image;
 }
@@ -284,8 +298,7 @@ static UIImage *SRGSelectedSubtitlesButtonImage(void)
     static UIImage *image;
     static dispatch_once_t onceToken;
     dispatch_once(&onceToken, ^{
-        NSString *imagePath = [[NSBundle srg_mediaPlayerBundle] pathForResource:@"alternate_tracks_button_selected" ofType:@"png"];
-        image = [[UIImage imageWithContentsOfFile:imagePath] imageWithRenderingMode:UIImageRenderingModeAlwaysTemplate];
+        image = [[NSBundle srg_mediaPlayerImageNamed:@"alternate_tracks_button_selected"] imageWithRenderingMode:UIImageRenderingModeAlwaysTemplate];
     });
     return image;
 }
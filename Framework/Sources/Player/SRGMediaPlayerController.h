@@ -9,11 +9,17 @@
 #import <UIKit/UIKit.h>
 
 #import "SRGMediaPlayerConstants.h"
+#import "SRGMediaPlayerPlaybackSnapshot.h"
+#import "SRGMediaPlayerStartupMetrics.h"
+#import "SRGMediaPlayerTelemetryReport.h"
 #import "SRGMediaPlayerView.h"
 #import "SRGSegment.h"
 
 NS_ASSUME_NONNULL_BEGIN
 
+// Forward declarations.
+@protocol SRGMediaPlayerControllerSegmentDelegate;
+
 /**
  *  `SRGMediaPlayerController` is inspired by the `MPMoviePlayerController` class. It manages the playback of a media 
  *  from a file or a network stream, but provides only core player functionality. As such, it is intended for custom
@@ -173,11 +179,65 @@ NS_ASSUME_NONNULL_BEGIN
 
 /**
  *  Return the tolerance (in seconds) for a DVR stream to be considered being played in live conditions. If the stream
- *  playhead is located within the last `liveTolerance` seconds of the stream, it is considered to be live. The default 
+ *  playhead is located within the last `liveTolerance` seconds of the stream, it is considered to be live. The default
  *  value is 30 seconds and matches the standard iOS player controller behavior.
  */
 @property (nonatomic) NSTimeInterval liveTolerance;
 
+/**
+ *  Set to `YES` to have the controller park its `AVPlayer` instance when playback is stopped or reset, instead of
+ *  destroying it. The next playback then only swaps the `AVPlayerItem` on the parked instance, which avoids full
+ *  player construction and reduces the time to first frame when switching between medias.
+ *
+ *  When a parked player is reused, the `playerCreationBlock` and `playerDestructionBlock` are not called, since the
+ *  instance is neither created nor destroyed. The `playerConfigurationBlock` is applied as usual. The `player`
+ *  property still returns `nil` while the controller is idle.
+ *
+ *  Default is `NO`.
+ */
+@property (nonatomic, getter=isPlayerReuseEnabled) BOOL playerReuseEnabled;
+
+/**
+ *  The priority with which the controller competes for decoder resources when several players are active at the same
+ *  time (see `SRGMediaPlayerResourceGovernor`). Controllers with background priority have their peak bit rate capped,
+ *  so that N-up layouts do not starve the stream the user is actually watching. Promoting a controller back to the
+ *  foreground priority lifts the cap immediately.
+ *
+ *  Default is `SRGMediaPlayerPlaybackPriorityForeground`.
+ */
+@property (nonatomic) SRGMediaPlayerPlaybackPriority playbackPriority;
+
+/**
+ *  Opt-in policy applied when the player view stops being visible (detached from any window, hidden, or scrolled
+ *  entirely offscreen), e.g. for inline players in scrolling feeds. Depending on the policy, video decoding is
+ *  suspended (audio continues) or playback is paused entirely, saving decode work and battery for output nobody
+ *  can see. Normal behavior is restored as soon as the view becomes visible again.
+ *
+ *  Default is `SRGMediaPlayerViewVisibilityPolicyNone`, i.e. rendering continues when the view is not visible.
+ */
+@property (nonatomic) SRGMediaPlayerViewVisibilityPolicy viewVisibilityPolicy;
+
+/**
+ *  The audio session category which must be applied when playback is prepared (see `AVAudioSession` for available
+ *  categories). The session is configured and activated asynchronously on a background queue, overlapping this
+ *  multi-hundred-millisecond operation with asset loading instead of serializing it on the main thread before the
+ *  first frame.
+ *
+ *  Default is `nil`, in which case the library does not touch the audio session and its management remains entirely
+ *  up to the application.
+ */
+@property (nonatomic, copy, nullable) NSString *audioSessionCategory;
+
+/**
+ *  When set to `YES`, periodic time observers registered with `-addPeriodicTimeObserverForInterval:queue:usingBlock:`
+ *  run at a relaxed cadence (at most one tick per second) while the player is paused, idle or has ended, and return
+ *  to their nominal cadence as soon as playback resumes. Screens left paused (e.g. a paused DVR stream with a
+ *  100 ms slider observer) otherwise keep waking up timers at full rate for values which barely change.
+ *
+ *  Default is `NO`.
+ */
+@property (nonatomic, getter=isObserverCadenceAdaptive) BOOL observerCadenceAdaptive;
+
 /**
  *  @name Player
  */
@@ -297,6 +357,9 @@ NS_ASSUME_NONNULL_BEGIN
  *  @discussion Upon completion handler entry, the playback state will be up-to-date if the seek finished, otherwise
  *              the player will still be in the seeking state. Note that if the media was not ready to play, seeking
  *              won't take place, and the completion handler won't be called.
+ *              While a seek is in flight, further seek requests are coalesced: Only the most recent request is kept
+ *              and issued when the in-flight seek returns, superseded requests complete with `finished` set to `NO`.
+ *              This keeps fast scrubbing responsive instead of queueing every intermediate seek.
  *              Refer to `-[AVPlayer seekToTime:toleranceBefore:toleranceAfter:completionHandler:]` documentation
  *              for more information about seek tolerances. Attempting to seek to a blocked segment will skip the segment
  *              and resume after it.
@@ -313,6 +376,44 @@ withToleranceBefore:(CMTime)toleranceBefore
  */
 - (void)reset;
 
+/**
+ *  Hand over ongoing playback to another media player controller, without interrupting it. The live `AVPlayer`
+ *  instance is detached from the receiver and adopted by the target controller (whose view starts rendering it),
+ *  together with the content URL, segments, user info and playback state. The receiver returns to the idle state,
+ *  as if it had been reset, while the stream keeps playing without any re-buffering.
+ *
+ *  This makes it possible to move playback between screens (e.g. from an inline cell to a fullscreen player)
+ *  without stopping one controller and re-preparing the other.
+ *
+ *  @param mediaPlayerController The controller which must adopt the ongoing playback. If it is currently playing
+ *                               some content, it is reset first.
+ *
+ *  @return `YES` iff the handoff took place. The method fails when no playback is ongoing or when attempting a
+ *          handoff to the receiver itself.
+ *
+ *  @discussion The target controller `playerCreationBlock` is not called, since the player instance is adopted, not
+ *              created. Its `playerConfigurationBlock` is applied as usual. Periodic time observers stay attached to
+ *              their respective controllers.
+ */
+- (BOOL)handOverPlaybackToController:(SRGMediaPlayerController *)mediaPlayerController;
+
+/**
+ *  Preload the media which must be played after the current one ends. The corresponding asset is loaded and an
+ *  `AVPlayerItem` built in the background while the current media keeps playing. When the current media plays to
+ *  its end, the preloaded item is promoted on the same `AVPlayer` instance and playback starts at its beginning,
+ *  chaining both medias with a near-zero gap instead of a full stop and preparation round trip.
+ *
+ *  @param URL      The URL of the next media, replacing any previously preloaded one. Pass `nil` to discard a
+ *                  previous preload request.
+ *  @param segments The segments associated with the next media, if any.
+ *
+ *  @discussion The preloaded media is discarded by `-stop`, `-reset` and the play / prepare methods. If no media
+ *              has been preloaded when the current one ends, the controller reaches the ended state as usual. The
+ *              promoted media starts with a `nil` user info, and the usual preparation state transitions (ended,
+ *              then preparing, then playing) are sent.
+ */
+- (void)preloadNextURL:(nullable NSURL *)URL withSegments:(nullable NSArray<id<SRGSegment>> *)segments;
+
 /**
  *  @name Playback information
  */
@@ -340,15 +441,43 @@ withToleranceBefore:(CMTime)toleranceBefore
 @property (nonatomic, readonly, nullable) NSDictionary *userInfo;
 
 /**
- *  The visible segments which have been loaded into the player.
+ *  The visible segments which have been loaded into the player. The list is computed once when segments are supplied,
+ *  accessing it is therefore cheap.
  */
 @property (nonatomic, readonly, nullable) NSArray<id<SRGSegment>> *visibleSegments;
 
+/**
+ *  Return the index of the specified segment in the visible segment list, `NSNotFound` if the segment is hidden or
+ *  does not belong to the registered segments.
+ */
+- (NSUInteger)indexOfVisibleSegment:(id<SRGSegment>)segment;
+
+/**
+ *  Translate an index in the visible segment list into the corresponding index in the full segment list, `NSNotFound`
+ *  if the index is invalid.
+ */
+- (NSUInteger)segmentIndexForVisibleSegmentIndex:(NSUInteger)visibleSegmentIndex;
+
+/**
+ *  Translate an index in the full segment list into the corresponding index in the visible segment list, `NSNotFound`
+ *  if the index is invalid or the segment is hidden.
+ */
+- (NSUInteger)visibleSegmentIndexForSegmentIndex:(NSUInteger)segmentIndex;
+
 /**
  *  Return the segment corresponding to the current playback position, `nil` if none.
  */
 @property (nonatomic, readonly, weak, nullable) id<SRGSegment> currentSegment;
 
+/**
+ *  Delegate directly notified of segment transitions, before the corresponding notifications are broadcast. Segment
+ *  transitions are evaluated at a 0.1 second cadence, and an `NSNotificationCenter` broadcast walks the global
+ *  observer table for each event. An overlay stack tracking the current segment can implement the delegate instead
+ *  and react with a single method call per transition. The usual notifications are still emitted for all other
+ *  consumers.
+ */
+@property (nonatomic, weak, nullable) id<SRGMediaPlayerControllerSegmentDelegate> segmentDelegate;
+
 /**
  *  The current media time range (might be empty or indefinite).
  *
@@ -361,6 +490,15 @@ withToleranceBefore:(CMTime)toleranceBefore
  */
 @property (nonatomic, readonly) CMTime currentTime;
 
+/**
+ *  Consistent snapshot of the playback status (state, position, time range, segment index), atomically published
+ *  on each playback state transition and observation tick. Unlike the individual properties above, which must be
+ *  read on the main thread, the snapshot can be read from any thread without locks or main-queue hops, making it
+ *  suitable for background consumers (e.g. analytics or watch-progress persistence). `nil` before playback has
+ *  been prepared for the first time.
+ */
+@property (atomic, readonly, nullable) SRGMediaPlayerPlaybackSnapshot *playbackSnapshot;
+
 /**
  *  The original time at which the player started seeking, `kCMTimeIndefinite` if none.
  */
@@ -387,11 +525,51 @@ withToleranceBefore:(CMTime)toleranceBefore
  */
 @property (nonatomic, readonly, nullable) NSDate *date;
 
+/**
+ *  Return the stream time corresponding to a wall-clock date, `kCMTimeIndefinite` if no date mapping is available
+ *  (on-demand streams, or when no reliable playback information exists yet). The returned time is clamped to the
+ *  current `timeRange`, so it can be supplied to a seek method directly (e.g. for a "jump to 19:30" feature in a
+ *  DVR user interface).
+ *
+ *  @discussion Conversions are backed by a cached stream position ↔ date anchor refreshed at the observation
+ *              cadence, so repeated conversions within a tick are plain arithmetic.
+ */
+- (CMTime)timeForDate:(nullable NSDate *)date;
+
+/**
+ *  Return the wall-clock date corresponding to a stream time, `nil` if no date mapping is available or the time
+ *  is invalid (see `-timeForDate:`).
+ */
+- (nullable NSDate *)dateForTime:(CMTime)time;
+
 /**
  *  Return `YES` iff the stream is currently played in live conditions (@see `liveTolerance`).
  */
 @property (nonatomic, readonly, getter=isLive) BOOL live;
 
+/**
+ *  Return the media selection group (e.g. subtitles, audio tracks) for the specified media characteristic, `nil` if
+ *  none is available. Groups are loaded asynchronously as soon as the played item is ready, and cached so that this
+ *  method answers instantly (a synchronous read from the asset would block the main thread until its media selection
+ *  data has been loaded). An `SRGMediaPlayerMediaSelectionGroupsDidBecomeAvailableNotification` is sent once the
+ *  groups are available.
+ */
+- (nullable AVMediaSelectionGroup *)mediaSelectionGroupForMediaCharacteristic:(NSString *)characteristic;
+
+/**
+ *  Startup phase timings for the current playback request, `nil` if no playback has been requested yet. Metrics are
+ *  filled as startup phases are reached; once playback effectively starts an
+ *  `SRGMediaPlayerStartupMetricsDidBecomeAvailableNotification` is sent.
+ */
+@property (nonatomic, readonly, nullable) SRGMediaPlayerStartupMetrics *startupMetrics;
+
+/**
+ *  The most recent telemetry reports for the current playback session, from oldest to most recent (see
+ *  `SRGMediaPlayerTelemetryReport`). Reports are published with
+ *  `SRGMediaPlayerTelemetryReportDidBecomeAvailableNotification` as they become available.
+ */
+@property (nonatomic, readonly) NSArray<SRGMediaPlayerTelemetryReport *> *telemetryReports;
+
 /**
  *  @name Time observers
  */
@@ -405,8 +583,8 @@ withToleranceBefore:(CMTime)toleranceBefore
  *  @param queue    The serial queue onto which block should be enqueued (main queue if `NULL`).
  *  @param block	The block to be periodically executed.
  *
- *  @return The time observer. The observer is retained by the media player controller, you can store a weak reference
- *          to it and remove it at a later time if needed.
+ *  @return An opaque token identifying the registration. The token is retained by the media player controller, you
+ *          can store a weak reference to it and remove the observer at a later time if needed.
  *
  *  @discussion Your can registers observers with the media player controller when you like (you do not have to wait until the player
  *              is ready, observers will be attached to it automatically when appropriate). Note that such observers are not removed
@@ -476,6 +654,13 @@ withToleranceBefore:(CMTime)toleranceBefore
  */
 - (void)seekPreciselyToTime:(CMTime)time withCompletionHandler:(nullable void (^)(BOOL finished))completionHandler;
 
+/**
+ *  Return the first time at or after the specified time which does not fall within a blocked segment (the specified
+ *  time itself if it is not blocked). Contiguous or overlapping blocked segments are cleared in a single query,
+ *  which makes the method suitable for skip-ahead user interfaces (e.g. snapping a slider out of blocked ranges).
+ */
+- (CMTime)firstNonBlockedTimeAfterTime:(CMTime)time;
+
 @end
 
 /**
@@ -597,4 +782,27 @@ withToleranceBefore:(CMTime)toleranceBefore
 
 @end
 
+/**
+ *  Delegate protocol for direct segment transition reporting (see the `segmentDelegate` property).
+ */
+@protocol SRGMediaPlayerControllerSegmentDelegate <NSObject>
+
+@optional
+
+/**
+ *  Called on the main thread when playback enters a (non-blocked) segment.
+ *
+ *  @param selected `YES` iff the transition results from a segment selection.
+ */
+- (void)mediaPlayerController:(SRGMediaPlayerController *)mediaPlayerController didStartSegment:(id<SRGSegment>)segment selected:(BOOL)selected;
+
+/**
+ *  Called on the main thread when playback leaves a (non-blocked) segment.
+ *
+ *  @param interrupted `YES` iff the segment was left before its end (e.g. because of a seek).
+ */
+- (void)mediaPlayerController:(SRGMediaPlayerController *)mediaPlayerController didEndSegment:(id<SRGSegment>)segment interrupted:(BOOL)interrupted;
+
+@end
+
 NS_ASSUME_NONNULL_END
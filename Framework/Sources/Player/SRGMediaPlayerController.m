@@ -10,11 +10,19 @@
 #import "AVPlayer+SRGMediaPlayer.h"
 #import "NSBundle+SRGMediaPlayer.h"
 #import "SRGActivityGestureRecognizer.h"
+#import "SRGMediaPlayerAssetCache.h"
 #import "SRGMediaPlayerError.h"
 #import "SRGMediaPlayerLogger.h"
+#import "SRGMediaPlayerPlaybackSnapshot+Private.h"
+#import "SRGMediaPlayerPlaybackStateChange+Private.h"
+#import "SRGMediaPlayerResourceGovernor+Private.h"
+#import "SRGMediaPlayerStartupMetrics+Private.h"
+#import "SRGMediaPlayerTelemetry.h"
+#import "SRGMediaPlayerTimeUtilities.h"
 #import "SRGMediaPlayerView.h"
 #import "SRGMediaPlayerView+Private.h"
 #import "SRGPeriodicTimeObserver.h"
+#import "SRGSegmentIndex.h"
 #import "UIScreen+SRGMediaPlayer.h"
 
 #import <libextobjc/libextobjc.h>
@@ -23,27 +31,63 @@
 
 static const NSTimeInterval SRGSegmentSeekToleranceInSeconds = 0.1;
 
+// Derived playback values (time range, stream type) are valid for one observation epoch, matching the fastest
+// observer cadence (the 0.1 second segment periodic observer). Several overlays querying these values within the
+// same tick therefore share a single computation
+static const NSTimeInterval SRGDerivedValuesCacheInterval = 0.1;
+
 static NSError *SRGMediaPlayerControllerError(NSError *underlyingError);
 static NSString *SRGMediaPlayerControllerNameForPlaybackState(SRGMediaPlayerPlaybackState playbackState);
 static NSString *SRGMediaPlayerControllerNameForMediaType(SRGMediaPlayerMediaType mediaType);
 static NSString *SRGMediaPlayerControllerNameForStreamType(SRGMediaPlayerStreamType streamType);
 
-@interface SRGMediaPlayerController () {
+@interface SRGMediaPlayerController () <SRGMediaPlayerViewVisibilityDelegate> {
 @private
     SRGMediaPlayerPlaybackState _playbackState;
     BOOL _selected;
     CMTimeRange _timeRange;
+
+    // Epoch cache for derived values, invalidated on time jumps and item changes, and expiring after
+    // `SRGDerivedValuesCacheInterval` so that DVR window movement is picked up
+    CMTimeRange _cachedTimeRange;
+    SRGMediaPlayerStreamType _cachedStreamType;
+    NSTimeInterval _derivedValuesCacheTime;             // 0 iff the cache is invalid
+
+    // Anchor pairing a stream position with the wall-clock date it corresponds to, making arbitrary time ↔ date
+    // conversions plain arithmetic. Follows the same epoch lifetime as the derived values above
+    CMTime _dateAnchorTime;
+    NSDate *_dateAnchorDate;                            // nil iff no date mapping is available
+    NSTimeInterval _dateAnchorCacheTime;                // 0 iff the anchor is invalid
 }
 
 @property (nonatomic) AVPlayer *player;
+@property (nonatomic) AVPlayer *parkedPlayer;                       // Player kept alive for reuse when `playerReuseEnabled` is set
 
 @property (nonatomic) NSURL *contentURL;
 @property (nonatomic) NSArray<id<SRGSegment>> *segments;
 @property (nonatomic) NSDictionary *userInfo;
 
-@property (nonatomic) NSArray<id<SRGSegment>> *visibleSegments;
+@property (nonatomic) SRGSegmentIndex *segmentIndex;
+
+// Atomic so that the immutable snapshot can be read from any thread without locks (safe publication is all we need,
+// the main thread is the only writer)
+@property (atomic) SRGMediaPlayerPlaybackSnapshot *playbackSnapshot;
+
+@property (nonatomic) SRGMediaPlayerStartupMetrics *startupMetrics;
+@property (nonatomic) SRGMediaPlayerTelemetry *telemetry;
 
-@property (nonatomic) NSMutableDictionary<NSString *, SRGPeriodicTimeObserver *> *periodicTimeObservers;
+// Playback state transitions accumulated during the current run-loop turn, coalesced into a single batched
+// notification at the end of the turn. The previous state value is non-nil iff a flush is scheduled
+@property (nonatomic) NSNumber *batchedPreviousPlaybackStateValue;
+@property (nonatomic) NSMutableArray<NSNumber *> *pendingPlaybackStates;
+
+// Media selection groups loaded asynchronously once the item is ready, keyed by media characteristic. Nil until
+// loading has completed
+@property (nonatomic) NSDictionary<NSString *, AVMediaSelectionGroup *> *loadedMediaSelectionGroups;
+
+// Contiguous observer storage. Observers are few and mostly registered once, a linear walk without any hashing is
+// cheaper than keyed storage both at registration time and on each tick
+@property (nonatomic) NSMutableArray<SRGPeriodicTimeObserver *> *periodicTimeObservers;
 @property (nonatomic) id segmentPeriodicTimeObserver;
 
 // Saved values supplied when playback is started
@@ -56,6 +100,10 @@ static NSString *SRGMediaPlayerControllerNameForStreamType(SRGMediaPlayerStreamT
 
 @property (nonatomic, getter=isTogglingAirplay) BOOL togglingAirplay;
 
+// `YES` iff playback was paused by the view visibility policy (and must therefore be resumed when the view becomes
+// visible again)
+@property (nonatomic, getter=isPausedByVisibilityPolicy) BOOL pausedByVisibilityPolicy;
+
 @property (nonatomic) AVPictureInPictureController *pictureInPictureController;
 
 @property (nonatomic) NSValue *startTimeValue;                      // Will be nilled when reached
@@ -64,6 +112,18 @@ static NSString *SRGMediaPlayerControllerNameForStreamType(SRGMediaPlayerStreamT
 @property (nonatomic) CMTime seekStartTime;
 @property (nonatomic) CMTime seekTargetTime;
 
+// Latest seek request received while another seek was in flight. Requests arriving during a seek are coalesced, only
+// the most recent one is kept and issued when the in-flight seek returns
+@property (nonatomic) NSValue *pendingSeekTimeValue;
+@property (nonatomic) NSValue *pendingSeekToleranceBeforeValue;
+@property (nonatomic) NSValue *pendingSeekToleranceAfterValue;
+@property (nonatomic, copy) void (^pendingSeekCompletionHandler)(BOOL);
+
+// Next media preloaded for gapless chaining, promoted when the current item plays to its end
+@property (nonatomic) NSURL *nextContentURL;
+@property (nonatomic) NSArray<id<SRGSegment>> *nextSegments;
+@property (nonatomic) AVPlayerItem *nextPlayerItem;
+
 @property (nonatomic, copy) void (^pictureInPictureControllerCreationBlock)(AVPictureInPictureController *pictureInPictureController);
 
 @end
@@ -81,7 +141,7 @@ static NSString *SRGMediaPlayerControllerNameForStreamType(SRGMediaPlayerStreamT
         _playbackState = SRGMediaPlayerPlaybackStateIdle;
         
         self.liveTolerance = SRGMediaPlayerLiveDefaultTolerance;
-        self.periodicTimeObservers = [NSMutableDictionary dictionary];
+        self.periodicTimeObservers = [NSMutableArray array];
         
         self.seekStartTime = kCMTimeIndefinite;
         self.seekTargetTime = kCMTimeIndefinite;
@@ -101,7 +161,8 @@ static NSString *SRGMediaPlayerControllerNameForStreamType(SRGMediaPlayerStreamT
 - (void)setPlayer:(AVPlayer *)player
 {
     BOOL hadPlayer = (_player != nil);
-    
+    AVPlayer *previousPlayer = _player;
+
     if (_player) {
         [self unregisterTimeObserversForPlayer:_player];
         
@@ -122,10 +183,11 @@ static NSString *SRGMediaPlayerControllerNameForStreamType(SRGMediaPlayerStreamT
     }
     
     _player = player;
-    self.playerLayer.player = player;
+    self.playerLayer.player = [self playerForLayerAttachment];
     
     if (player) {
-        if (! hadPlayer) {
+        // No creation block for a parked player being reused, the instance has not been created anew
+        if (! hadPlayer && player != self.parkedPlayer) {
             self.playerCreationBlock ? self.playerCreationBlock(player) : nil;
         }
         
@@ -140,6 +202,9 @@ static NSString *SRGMediaPlayerControllerNameForStreamType(SRGMediaPlayerStreamT
             AVPlayerItem *playerItem = player.currentItem;
             
             if (playerItem.status == AVPlayerItemStatusReadyToPlay) {
+                [self.startupMetrics recordItemReady];
+                [self loadMediaSelectionGroupsForPlayerItem:playerItem];
+
                 // Playback start. Use received start parameters, do not update the playback state yet, wait until the
                 // completion handler has been executed (since it might immediately start playback)
                 if (self.startTimeValue) {
@@ -260,9 +325,16 @@ static NSString *SRGMediaPlayerControllerNameForStreamType(SRGMediaPlayerStreamT
                                                    object:player.currentItem];
         
         self.playerConfigurationBlock ? self.playerConfigurationBlock(player) : nil;
+
+        [[SRGMediaPlayerResourceGovernor sharedGovernor] registerMediaPlayerController:self];
     }
-    else if (hadPlayer) {
-        self.playerDestructionBlock ? self.playerDestructionBlock() : nil;
+    else {
+        [[SRGMediaPlayerResourceGovernor sharedGovernor] unregisterMediaPlayerController:self];
+
+        // No destruction block for a player which has been parked, the instance stays alive for reuse
+        if (hadPlayer && previousPlayer != self.parkedPlayer) {
+            self.playerDestructionBlock ? self.playerDestructionBlock() : nil;
+        }
     }
 }
 
@@ -274,6 +346,16 @@ static NSString *SRGMediaPlayerControllerNameForStreamType(SRGMediaPlayerStreamT
     return self.view.playerLayer;
 }
 
+- (AVPlayer *)playerForLayerAttachment
+{
+    // Honor the visibility policy: do not decode video into a layer nobody can see. Attachment is restored when the
+    // view reports it became visible again
+    if (self.viewVisibilityPolicy == SRGMediaPlayerViewVisibilityPolicyDetachRendering && _view && ! _view.visibleOnScreen) {
+        return nil;
+    }
+    return self.player;
+}
+
 - (void)setPlaybackState:(SRGMediaPlayerPlaybackState)playbackState withUserInfo:(NSDictionary *)userInfo
 {
     NSAssert([NSThread isMainThread], @"Not the main thread. Ensure important changes must be notified on the main thread. Fix");
@@ -283,10 +365,18 @@ static NSString *SRGMediaPlayerControllerNameForStreamType(SRGMediaPlayerStreamT
     }
     
     SRGMediaPlayerPlaybackState previousPlaybackState = _playbackState;
-    
+
+    BOOL selected = self.targetSegment && ! self.targetSegment.srg_blocked;
+
+    // Pooled typed payload, letting high-frequency consumers read the transition without unboxing dictionary values
+    SRGMediaPlayerPlaybackStateChange *playbackStateChange = [SRGMediaPlayerPlaybackStateChange changeWithPlaybackState:playbackState
+                                                                                                  previousPlaybackState:previousPlaybackState
+                                                                                                               selected:selected];
+
     NSMutableDictionary *fullUserInfo = [@{ SRGMediaPlayerPlaybackStateKey : @(playbackState),
-                                            SRGMediaPlayerPreviousPlaybackStateKey: @(previousPlaybackState) } mutableCopy];
-    fullUserInfo[SRGMediaPlayerSelectionKey] = @(self.targetSegment && ! self.targetSegment.srg_blocked);
+                                            SRGMediaPlayerPreviousPlaybackStateKey: @(previousPlaybackState),
+                                            SRGMediaPlayerPlaybackStateChangeKey : playbackStateChange } mutableCopy];
+    fullUserInfo[SRGMediaPlayerSelectionKey] = @(selected);
     if (userInfo) {
         [fullUserInfo addEntriesFromDictionary:userInfo];
     }
@@ -297,44 +387,131 @@ static NSString *SRGMediaPlayerControllerNameForStreamType(SRGMediaPlayerStreamT
     
     // Ensure segment status is up to date
     [self updateSegmentStatusForPlaybackState:playbackState previousPlaybackState:previousPlaybackState time:self.player.currentTime];
+
+    [self updateObserverCadenceForPlaybackState:playbackState];
+
+    // Published after the segment status update so that the snapshot captures a consistent segment index
+    [self updatePlaybackSnapshotForPlaybackState:playbackState time:self.player.currentTime];
+
+    // Keep track of stall boundaries, from which the telemetry pipeline aggregates time spent stalled
+    if (playbackState == SRGMediaPlayerPlaybackStateStalled) {
+        [self.telemetry recordStallStart];
+    }
+    else if (previousPlaybackState == SRGMediaPlayerPlaybackStateStalled) {
+        [self.telemetry recordStallEnd];
+    }
     
     [[NSNotificationCenter defaultCenter] postNotificationName:SRGMediaPlayerPlaybackStateDidChangeNotification
                                                         object:self
                                                       userInfo:[fullUserInfo copy]];
-    
+
+    // Delivery is synchronous, the payload can be returned to the pool once all observers have been called out
+    [playbackStateChange srg_recycle];
+
+    [self enqueueBatchedPlaybackStateChangeFromPlaybackState:previousPlaybackState toPlaybackState:playbackState];
+
+    // Playback effectively starting completes the startup phase measurements
+    if (playbackState == SRGMediaPlayerPlaybackStatePlaying && self.startupMetrics && self.startupMetrics.playingInterval < 0.) {
+        [self.startupMetrics recordPlaying];
+        [[NSNotificationCenter defaultCenter] postNotificationName:SRGMediaPlayerStartupMetricsDidBecomeAvailableNotification
+                                                            object:self
+                                                          userInfo:@{ SRGMediaPlayerStartupMetricsKey : self.startupMetrics }];
+    }
+
     SRGMediaPlayerLogDebug(@"Controller", @"Playback state did change to %@ with info %@", SRGMediaPlayerControllerNameForPlaybackState(playbackState), fullUserInfo);
 }
 
+- (void)enqueueBatchedPlaybackStateChangeFromPlaybackState:(SRGMediaPlayerPlaybackState)previousPlaybackState
+                                           toPlaybackState:(SRGMediaPlayerPlaybackState)playbackState
+{
+    if (! self.batchedPreviousPlaybackStateValue) {
+        self.batchedPreviousPlaybackStateValue = @(previousPlaybackState);
+        self.pendingPlaybackStates = [NSMutableArray array];
+
+        // Flush at the end of the current run-loop turn, so that bursts of transitions (e.g. during startup or
+        // seeks) wake batched observers only once
+        dispatch_async(dispatch_get_main_queue(), ^{
+            [self flushBatchedPlaybackStateChange];
+        });
+    }
+    [self.pendingPlaybackStates addObject:@(playbackState)];
+}
+
+- (void)flushBatchedPlaybackStateChange
+{
+    NSArray<NSNumber *> *playbackStates = self.pendingPlaybackStates;
+    NSNumber *previousPlaybackStateValue = self.batchedPreviousPlaybackStateValue;
+
+    self.batchedPreviousPlaybackStateValue = nil;
+    self.pendingPlaybackStates = nil;
+
+    NSDictionary *userInfo = @{ SRGMediaPlayerPlaybackStateKey : playbackStates.lastObject,
+                                SRGMediaPlayerPreviousPlaybackStateKey : previousPlaybackStateValue,
+                                SRGMediaPlayerIntermediatePlaybackStatesKey : [playbackStates subarrayWithRange:NSMakeRange(0, playbackStates.count - 1)] };
+    [[NSNotificationCenter defaultCenter] postNotificationName:SRGMediaPlayerBatchedPlaybackStateDidChangeNotification
+                                                        object:self
+                                                      userInfo:userInfo];
+}
+
 - (void)setSegments:(NSArray<id<SRGSegment>> *)segments
 {
     _segments = segments;
-    
-    // Reset the cached visible segment list
-    _visibleSegments = nil;
+
+    // Rebuild the interval index so that per-tick segment lookups remain cheap for large timelines. The index also
+    // eagerly partitions segments into visible / hidden lists
+    self.segmentIndex = [[SRGSegmentIndex alloc] initWithSegments:segments];
+}
+
+- (void)setPlaybackPriority:(SRGMediaPlayerPlaybackPriority)playbackPriority
+{
+    _playbackPriority = playbackPriority;
+    [[SRGMediaPlayerResourceGovernor sharedGovernor] updateResourceCaps];
+}
+
+- (void)setObserverCadenceAdaptive:(BOOL)observerCadenceAdaptive
+{
+    _observerCadenceAdaptive = observerCadenceAdaptive;
+    [self updateObserverCadenceForPlaybackState:self.playbackState];
 }
 
 - (NSArray<id<SRGSegment>> *)visibleSegments
 {
-    // Cached for faster access
-    if (! _visibleSegments) {
-        NSPredicate *predicate = [NSPredicate predicateWithFormat:@"srg_hidden == NO"];
-        _visibleSegments = [self.segments filteredArrayUsingPredicate:predicate];
-    }
-    return _visibleSegments;
+    return self.segmentIndex.visibleSegments;
+}
+
+- (NSUInteger)indexOfVisibleSegment:(id<SRGSegment>)segment
+{
+    // Careful: Messaging nil would return 0, not NSNotFound
+    return self.segmentIndex ? [self.segmentIndex indexOfVisibleSegment:segment] : NSNotFound;
+}
+
+- (NSUInteger)segmentIndexForVisibleSegmentIndex:(NSUInteger)visibleSegmentIndex
+{
+    return self.segmentIndex ? [self.segmentIndex segmentIndexForVisibleSegmentIndex:visibleSegmentIndex] : NSNotFound;
+}
+
+- (NSUInteger)visibleSegmentIndexForSegmentIndex:(NSUInteger)segmentIndex
+{
+    return self.segmentIndex ? [self.segmentIndex visibleSegmentIndexForSegmentIndex:segmentIndex] : NSNotFound;
 }
 
 // Called when installing the view by binding it in a storyboard or xib
 - (void)setView:(SRGMediaPlayerView *)view
 {
     _view = view;
-    
+
     if (_view) {
+        _view.visibilityDelegate = self;
+
         AVPlayerLayer *playerLayer = _view.playerLayer;
-        playerLayer.player = self.player;
-        
+        playerLayer.player = [self playerForLayerAttachment];
+
         @weakify(self)
         [playerLayer addObserver:self keyPath:@keypath(playerLayer.readyForDisplay) options:0 block:^(MAKVONotification *notification) {
             @strongify(self)
+            if (playerLayer.readyForDisplay) {
+                [self.startupMetrics recordFirstFrame];
+            }
             [self updatePictureInPictureController];
         }];
     }
@@ -345,13 +522,17 @@ static NSString *SRGMediaPlayerControllerNameForStreamType(SRGMediaPlayerStreamT
 {
     if (! _view) {
         _view = [[SRGMediaPlayerView alloc] init];
-        
+        _view.visibilityDelegate = self;
+
         AVPlayerLayer *playerLayer = _view.playerLayer;
-        playerLayer.player = self.player;
-        
+        playerLayer.player = [self playerForLayerAttachment];
+
         @weakify(self)
         [playerLayer addObserver:self keyPath:@keypath(playerLayer.readyForDisplay) options:0 block:^(MAKVONotification *notification) {
             @strongify(self)
+            if (playerLayer.readyForDisplay) {
+                [self.startupMetrics recordFirstFrame];
+            }
             [self updatePictureInPictureController];
         }];
     }
@@ -364,36 +545,54 @@ static NSString *SRGMediaPlayerControllerNameForStreamType(SRGMediaPlayerStreamT
     if (CMTIMERANGE_IS_VALID(_timeRange)) {
         return _timeRange;
     }
-    
+
+    if ([self isDerivedValuesCacheValid]) {
+        return _cachedTimeRange;
+    }
+
     AVPlayerItem *playerItem = self.player.currentItem;
-    
+
     // If no seekable time range information is available, return a time range of length 0
+    CMTimeRange timeRange = kCMTimeRangeInvalid;
+
     NSValue *firstSeekableTimeRangeValue = [playerItem.seekableTimeRanges firstObject];
     NSValue *lastSeekableTimeRangeValue = [playerItem.seekableTimeRanges lastObject];
-    if (! firstSeekableTimeRangeValue || ! lastSeekableTimeRangeValue) {
-        return kCMTimeRangeInvalid;
+    if (firstSeekableTimeRangeValue && lastSeekableTimeRangeValue) {
+        CMTimeRange firstSeekableTimeRange = [firstSeekableTimeRangeValue CMTimeRangeValue];
+        CMTimeRange lastSeekableTimeRange = [lastSeekableTimeRangeValue CMTimeRangeValue];
+
+        if (CMTIMERANGE_IS_VALID(firstSeekableTimeRange) && CMTIMERANGE_IS_VALID(lastSeekableTimeRange)) {
+            timeRange = CMTimeRangeFromTimeToTime(firstSeekableTimeRange.start, CMTimeRangeGetEnd(lastSeekableTimeRange));
+
+            // DVR window size too small. Check that we the stream is not an on-demand one first, of course
+            if (CMTIME_IS_INDEFINITE(playerItem.duration) && CMTimeGetSeconds(timeRange.duration) < self.minimumDVRWindowLength) {
+                timeRange = CMTimeRangeMake(timeRange.start, kCMTimeZero);
+            }
+
+            // On-demand time ranges are cached because they might become unreliable in some situations (e.g. when
+            // Airplay is connected or disconnected)
+            if (! CMTIME_IS_INDEFINITE(playerItem.duration) && ! CMTIMERANGE_IS_EMPTY(timeRange)) {
+                _timeRange = timeRange;
+            }
+        }
     }
-    
-    CMTimeRange firstSeekableTimeRange = [firstSeekableTimeRangeValue CMTimeRangeValue];
-    CMTimeRange lastSeekableTimeRange = [lastSeekableTimeRangeValue CMTimeRangeValue];
-    
-    if (CMTIMERANGE_IS_INVALID(firstSeekableTimeRange) || CMTIMERANGE_IS_INVALID(lastSeekableTimeRange)) {
-        return kCMTimeRangeInvalid;
+
+    // Stamp the epoch cache, deriving the stream type from values at hand
+    _cachedTimeRange = timeRange;
+    if (CMTIMERANGE_IS_INVALID(timeRange)) {
+        _cachedStreamType = SRGMediaPlayerStreamTypeUnknown;
     }
-    
-    CMTimeRange timeRange = CMTimeRangeFromTimeToTime(firstSeekableTimeRange.start, CMTimeRangeGetEnd(lastSeekableTimeRange));
-    
-    // DVR window size too small. Check that we the stream is not an on-demand one first, of course
-    if (CMTIME_IS_INDEFINITE(playerItem.duration) && CMTimeGetSeconds(timeRange.duration) < self.minimumDVRWindowLength) {
-        timeRange = CMTimeRangeMake(timeRange.start, kCMTimeZero);
+    else if (CMTIMERANGE_IS_EMPTY(timeRange)) {
+        _cachedStreamType = SRGMediaPlayerStreamTypeLive;
     }
-    
-    // On-demand time ranges are cached because they might become unreliable in some situations (e.g. when Airplay is
-    // connected or disconnected)
-    if (! CMTIME_IS_INDEFINITE(playerItem.duration) && ! CMTIMERANGE_IS_EMPTY(timeRange)) {
-        _timeRange = timeRange;
+    else if (CMTIME_IS_INDEFINITE(playerItem.duration)) {
+        _cachedStreamType = SRGMediaPlayerStreamTypeDVR;
     }
-    
+    else {
+        _cachedStreamType = SRGMediaPlayerStreamTypeOnDemand;
+    }
+    _derivedValuesCacheTime = NSProcessInfo.processInfo.systemUptime;
+
     return timeRange;
 }
 
@@ -419,20 +618,30 @@ static NSString *SRGMediaPlayerControllerNameForStreamType(SRGMediaPlayerStreamT
 
 - (SRGMediaPlayerStreamType)streamType
 {
-    CMTimeRange timeRange = self.timeRange;
-    
-    if (CMTIMERANGE_IS_INVALID(timeRange)) {
-        return SRGMediaPlayerStreamTypeUnknown;
-    }
-    else if (CMTIMERANGE_IS_EMPTY(timeRange)) {
-        return SRGMediaPlayerStreamTypeLive;
-    }
-    else if (CMTIME_IS_INDEFINITE(self.player.currentItem.duration)) {
-        return SRGMediaPlayerStreamTypeDVR;
-    }
-    else {
-        return SRGMediaPlayerStreamTypeOnDemand;
+    if (! [self isDerivedValuesCacheValid]) {
+        // Computing the time range fills the epoch cache, stream type included
+        [self timeRange];
     }
+    return _cachedStreamType;
+}
+
+- (NSArray<SRGMediaPlayerTelemetryReport *> *)telemetryReports
+{
+    return self.telemetry.recentReports ?: @[];
+}
+
+#pragma mark Derived values cache
+
+- (BOOL)isDerivedValuesCacheValid
+{
+    return _derivedValuesCacheTime != 0.
+        && NSProcessInfo.processInfo.systemUptime - _derivedValuesCacheTime < SRGDerivedValuesCacheInterval;
+}
+
+- (void)invalidateDerivedValuesCache
+{
+    _derivedValuesCacheTime = 0.;
+    _dateAnchorCacheTime = 0.;
 }
 
 - (void)setMinimumDVRWindowLength:(NSTimeInterval)minimumDVRWindowLength
@@ -459,20 +668,59 @@ static NSString *SRGMediaPlayerControllerNameForStreamType(SRGMediaPlayerStreamT
 
 - (NSDate *)date
 {
-    CMTimeRange timeRange = self.timeRange;
-    if (CMTIMERANGE_IS_INVALID(timeRange)) {
-        return nil;
+    return [self dateForTime:self.player.currentTime];
+}
+
+#pragma mark Date indexing
+
+- (BOOL)loadDateAnchor
+{
+    if (_dateAnchorCacheTime != 0.
+            && NSProcessInfo.processInfo.systemUptime - _dateAnchorCacheTime < SRGDerivedValuesCacheInterval) {
+        return _dateAnchorDate != nil;
     }
-    
-    if (self.streamType == SRGMediaPlayerStreamTypeLive) {
-        return [NSDate date];
+
+    switch (self.streamType) {
+        case SRGMediaPlayerStreamTypeLive: {
+            _dateAnchorTime = self.player.currentTime;
+            _dateAnchorDate = [NSDate date];
+            break;
+        }
+
+        case SRGMediaPlayerStreamTypeDVR: {
+            // Anchor the live edge of the DVR window to the current date
+            _dateAnchorTime = CMTimeRangeGetEnd(self.timeRange);
+            _dateAnchorDate = [NSDate date];
+            break;
+        }
+
+        default: {
+            _dateAnchorDate = nil;
+            break;
+        }
     }
-    else if (self.streamType == SRGMediaPlayerStreamTypeDVR) {
-        return [NSDate dateWithTimeIntervalSinceNow:-CMTimeGetSeconds(CMTimeSubtract(CMTimeRangeGetEnd(timeRange), self.player.currentTime))];
+    _dateAnchorCacheTime = NSProcessInfo.processInfo.systemUptime;
+
+    return _dateAnchorDate != nil;
+}
+
+- (CMTime)timeForDate:(NSDate *)date
+{
+    if (! date || ! [self loadDateAnchor]) {
+        return kCMTimeIndefinite;
     }
-    else {
+
+    CMTime offset = CMTimeMakeWithSeconds([date timeIntervalSinceDate:_dateAnchorDate], NSEC_PER_SEC);
+    return SRGMediaPlayerTimeClampedToRange(CMTimeAdd(_dateAnchorTime, offset), self.timeRange);
+}
+
+- (NSDate *)dateForTime:(CMTime)time
+{
+    if (CMTIME_IS_INVALID(time) || ! [self loadDateAnchor]) {
         return nil;
     }
+
+    return [_dateAnchorDate dateByAddingTimeInterval:CMTimeGetSeconds(CMTimeSubtract(time, _dateAnchorTime))];
 }
 
 - (BOOL)isLive
@@ -486,7 +734,7 @@ static NSString *SRGMediaPlayerControllerNameForStreamType(SRGMediaPlayerStreamT
         return YES;
     }
     else if (self.streamType == SRGMediaPlayerStreamTypeDVR) {
-        return CMTimeGetSeconds(CMTimeSubtract(CMTimeRangeGetEnd(self.timeRange), playerItem.currentTime)) < self.liveTolerance;
+        return SRGMediaPlayerTimeIntervalFromRangeEnd(playerItem.currentTime, self.timeRange) < self.liveTolerance;
     }
     else {
         return NO;
@@ -637,6 +885,138 @@ withToleranceBefore:(CMTime)toleranceBefore
     [self stopWithUserInfo:[userInfo copy]];
 }
 
+- (BOOL)handOverPlaybackToController:(SRGMediaPlayerController *)mediaPlayerController
+{
+    NSAssert([NSThread isMainThread], @"Handoffs move rendering between views and must be performed on the main thread");
+
+    if (! self.player || ! mediaPlayerController || mediaPlayerController == self) {
+        return NO;
+    }
+
+    SRGMediaPlayerLogDebug(@"Controller", @"Handing over playback of %@ to %@", self.contentURL, mediaPlayerController);
+
+    // Ensure the target controller is idle before it adopts the playback
+    [mediaPlayerController reset];
+
+    AVPlayer *player = self.player;
+    SRGMediaPlayerPlaybackState playbackState = self.playbackState;
+
+    NSURL *contentURL = self.contentURL;
+    NSArray<id<SRGSegment>> *segments = self.segments;
+    NSDictionary *userInfo = self.userInfo;
+
+    SRGMediaPlayerStartupMetrics *startupMetrics = self.startupMetrics;
+    NSDictionary<NSString *, AVMediaSelectionGroup *> *loadedMediaSelectionGroups = self.loadedMediaSelectionGroups;
+
+    id<SRGSegment> initialTargetSegment = self.initialTargetSegment;
+    NSValue *initialStartTimeValue = self.initialStartTimeValue;
+
+    // Save previous state information for the idle notification sent when the source controller lets go of the playback
+    NSMutableDictionary *sourceUserInfo = [NSMutableDictionary dictionary];
+    sourceUserInfo[SRGMediaPlayerPreviousContentURLKey] = contentURL;
+    sourceUserInfo[SRGMediaPlayerPreviousUserInfoKey] = userInfo;
+    sourceUserInfo[SRGMediaPlayerLastPlaybackTimeKey] = [NSValue valueWithCMTime:player.currentTime];
+    sourceUserInfo[SRGMediaPlayerPreviousTimeRangeKey] = [NSValue valueWithCMTimeRange:self.timeRange];
+    sourceUserInfo[SRGMediaPlayerPreviousMediaTypeKey] = @(self.mediaType);
+    sourceUserInfo[SRGMediaPlayerPreviousStreamTypeKey] = @(self.streamType);
+
+    // Flush telemetry while the item is still associated with the source controller
+    [self.telemetry stop];
+    self.telemetry = nil;
+
+    // Detach the player from the source controller without pausing it. The parked player bookkeeping provides exactly
+    // the required detachment semantics (observers unregistered, layer detached, no destruction block called since
+    // the instance lives on)
+    self.parkedPlayer = player;
+    self.player = nil;
+    self.parkedPlayer = nil;
+
+    // Return the source controller to the idle state, following the same bookkeeping as a stop
+    self.contentURL = nil;
+    self.segments = nil;
+    self.userInfo = nil;
+
+    self.initialTargetSegment = nil;
+    self.initialStartTimeValue = nil;
+
+    self.startupMetrics = nil;
+    self.loadedMediaSelectionGroups = nil;
+
+    [self setPlaybackState:SRGMediaPlayerPlaybackStateIdle withUserInfo:[sourceUserInfo copy]];
+
+    _timeRange = kCMTimeRangeInvalid;
+    [self invalidateDerivedValuesCache];
+
+    self.previousSegment = nil;
+    self.targetSegment = nil;
+    self.currentSegment = nil;
+
+    self.startTimeValue = nil;
+    self.startCompletionHandler = nil;
+
+    // Discard any coalesced seek request, honoring its completion handler contract
+    self.pendingSeekCompletionHandler ? self.pendingSeekCompletionHandler(NO) : nil;
+    [self clearPendingSeek];
+
+    self.seekStartTime = kCMTimeIndefinite;
+    self.seekTargetTime = kCMTimeIndefinite;
+
+    // Adopt the playback in the target controller. Attaching the player to its layer does not interrupt decode
+    mediaPlayerController.contentURL = contentURL;
+    mediaPlayerController.segments = segments;
+    mediaPlayerController.userInfo = userInfo;
+
+    mediaPlayerController.initialTargetSegment = initialTargetSegment;
+    mediaPlayerController.initialStartTimeValue = initialStartTimeValue;
+
+    mediaPlayerController.startupMetrics = startupMetrics;
+    mediaPlayerController.loadedMediaSelectionGroups = loadedMediaSelectionGroups;
+
+    mediaPlayerController->_timeRange = kCMTimeRangeInvalid;
+    [mediaPlayerController invalidateDerivedValuesCache];
+
+    // No creation block must be called for an adopted player instance, which has not been created anew (see `-setPlayer:`)
+    mediaPlayerController.parkedPlayer = player;
+    mediaPlayerController.player = player;
+    mediaPlayerController.parkedPlayer = nil;
+
+    mediaPlayerController.telemetry = [[SRGMediaPlayerTelemetry alloc] initWithMediaPlayerController:mediaPlayerController];
+    [mediaPlayerController.telemetry startWithPlayerItem:player.currentItem];
+
+    [mediaPlayerController setPlaybackState:playbackState withUserInfo:nil];
+
+    return YES;
+}
+
+- (void)preloadNextURL:(NSURL *)URL withSegments:(NSArray<id<SRGSegment>> *)segments
+{
+    if (! URL) {
+        [self discardPreloadedNextMedia];
+        return;
+    }
+
+    SRGMediaPlayerLogDebug(@"Controller", @"Preloading next media %@", URL);
+
+    // Reuse a prewarmed asset when available, otherwise start the loading round trips now, while the current media
+    // still plays
+    AVURLAsset *asset = [[SRGMediaPlayerAssetCache sharedAssetCache] takeAssetForURL:URL];
+    if (! asset) {
+        asset = [AVURLAsset assetWithURL:URL];
+        [asset loadValuesAsynchronouslyForKeys:@[ @"playable", @"duration" ] completionHandler:nil];
+    }
+
+    self.nextContentURL = URL;
+    self.nextSegments = segments;
+    self.nextPlayerItem = [[AVPlayerItem alloc] initWithAsset:asset];
+}
+
+- (void)discardPreloadedNextMedia
+{
+    self.nextContentURL = nil;
+    self.nextSegments = nil;
+    self.nextPlayerItem = nil;
+}
+
 #pragma mark Playback (convenience methods)
 
 - (void)prepareToPlayURL:(NSURL *)URL withCompletionHandler:(void (^)(void))completionHandler
@@ -711,7 +1091,7 @@ withToleranceBefore:(CMTime)toleranceBefore
 
 - (void)seekToSegment:(id<SRGSegment>)segment withCompletionHandler:(void (^)(BOOL))completionHandler
 {
-    if (! [self.segments containsObject:segment]) {
+    if (! [self.segmentIndex containsSegment:segment]) {
         return;
     }
     
@@ -750,24 +1130,52 @@ withToleranceBefore:(CMTime)toleranceBefore
     SRGMediaPlayerLogDebug(@"Controller", @"Playing %@", URL);
     
     [self reset];
-    
+
     _timeRange = kCMTimeRangeInvalid;
-    
+    [self invalidateDerivedValuesCache];
+
     self.contentURL = URL;
     self.segments = segments;
     self.userInfo = userInfo;
     self.targetSegment = targetSegment;
+
+    self.startupMetrics = [SRGMediaPlayerStartupMetrics startupMetrics];
+    self.loadedMediaSelectionGroups = nil;
     
     self.startTimeValue = [NSValue valueWithCMTime:time];
     self.startCompletionHandler = completionHandler;
-    
+
     // Save initial values for restart after a stop
     self.initialTargetSegment = targetSegment;
     self.initialStartTimeValue = self.startTimeValue;
-    
-    AVPlayerItem *playerItem = [[AVPlayerItem alloc] initWithURL:URL];
-    self.player = [AVPlayer playerWithPlayerItem:playerItem];
-    
+
+    // Configure the audio session on a background queue, overlapping this slow operation with asset loading
+    if (self.audioSessionCategory) {
+        [AVAudioSession srg_configureWithCategory:self.audioSessionCategory completionHandler:^(NSError *error) {
+            if (error) {
+                SRGMediaPlayerLogWarning(@"Controller", @"Audio session configuration failed with error: %@", error);
+            }
+        }];
+    }
+
+    // Use a prewarmed asset if one is available for the URL, so that the loading work already performed is not lost
+    AVURLAsset *asset = [[SRGMediaPlayerAssetCache sharedAssetCache] takeAssetForURL:URL];
+    AVPlayerItem *playerItem = asset ? [[AVPlayerItem alloc] initWithAsset:asset] : [[AVPlayerItem alloc] initWithURL:URL];
+
+    // Reuse a parked player if available, swapping only the item (much cheaper than building a player from scratch)
+    AVPlayer *parkedPlayer = self.parkedPlayer;
+    if (parkedPlayer) {
+        [parkedPlayer replaceCurrentItemWithPlayerItem:playerItem];
+        self.player = parkedPlayer;
+        self.parkedPlayer = nil;
+    }
+    else {
+        self.player = [AVPlayer playerWithPlayerItem:playerItem];
+    }
+
+    self.telemetry = [[SRGMediaPlayerTelemetry alloc] initWithMediaPlayerController:self];
+    [self.telemetry startWithPlayerItem:playerItem];
+
     // Notify the state change last. If clients repond to the preparing state change notification, the state need to
     // be fully consistent first.
     [self setPlaybackState:SRGMediaPlayerPlaybackStatePreparing withUserInfo:nil];
@@ -779,46 +1187,151 @@ withToleranceBefore:(CMTime)toleranceBefore
      targetSegment:(id<SRGSegment>)targetSegment
  completionHandler:(void (^)(BOOL))completionHandler
 {
-    NSAssert(! targetSegment || [self.segments containsObject:targetSegment], @"Segment must be valid");
+    NSAssert(! targetSegment || [self.segmentIndex containsSegment:targetSegment], @"Segment must be valid");
     
     if (CMTIME_IS_INVALID(time) || self.player.currentItem.status != AVPlayerItemStatusReadyToPlay) {
         return;
     }
     
     self.targetSegment = targetSegment;
-    
+
     // Trap attempts to seek to blocked segments early. We cannot only rely on playback time observers to detect a blocked segment
-    // for direct seeks, otherwise blocked segment detection would occur after the segment has been entered, which is too late
-    id<SRGSegment> segment = targetSegment ?: [self segmentForTime:time];
+    // for direct seeks, otherwise blocked segment detection would occur after the segment has been entered, which is too late.
+    // The merged blocked range index answers the common non-blocked case without touching any segment object
+    id<SRGSegment> segment = targetSegment ?: ([self.segmentIndex isTimeBlocked:time] ? [self segmentForTime:time] : nil);
     if (! segment || ! segment.srg_blocked) {
+        BOOL seekInFlight = ! CMTIME_IS_INDEFINITE(self.seekStartTime);
+
         [self setPlaybackState:SRGMediaPlayerPlaybackStateSeeking withUserInfo:nil];
-        
+
         [[NSNotificationCenter defaultCenter] postNotificationName:SRGMediaPlayerSeekNotification
                                                             object:self
                                                           userInfo:@{ SRGMediaPlayerSeekTimeKey : [NSValue valueWithCMTime:time],
                                                                       SRGMediaPlayerLastPlaybackTimeKey : [NSValue valueWithCMTime:self.player.currentTime] }];
-        
+
         // Only store the origin in case of multiple seeks, but update the target
-        if (CMTIME_IS_INDEFINITE(self.seekStartTime)) {
+        if (! seekInFlight) {
             self.seekStartTime = self.player.currentTime;
         }
         self.seekTargetTime = time;
-        
-        [self.player seekToTime:time toleranceBefore:toleranceBefore toleranceAfter:toleranceAfter completionHandler:^(BOOL finished) {
-            if (finished) {
-                [self setPlaybackState:(self.player.rate == 0.f) ? SRGMediaPlayerPlaybackStatePaused : SRGMediaPlayerPlaybackStatePlaying withUserInfo:nil];
-                
-                self.seekStartTime = kCMTimeIndefinite;
-                self.seekTargetTime = kCMTimeIndefinite;
-            }
-            completionHandler ? completionHandler(finished) : nil;
-        }];
+
+        // While a seek is in flight, coalesce requests: keep only the latest one and issue it when the in-flight
+        // seek returns. This avoids queueing a convoy of decoder seeks during fast scrubbing
+        if (seekInFlight) {
+            self.pendingSeekCompletionHandler ? self.pendingSeekCompletionHandler(NO) : nil;
+
+            self.pendingSeekTimeValue = [NSValue valueWithCMTime:time];
+            self.pendingSeekToleranceBeforeValue = [NSValue valueWithCMTime:toleranceBefore];
+            self.pendingSeekToleranceAfterValue = [NSValue valueWithCMTime:toleranceAfter];
+            self.pendingSeekCompletionHandler = completionHandler;
+            return;
+        }
+
+        [self executeSeekToTime:time withToleranceBefore:toleranceBefore toleranceAfter:toleranceAfter completionHandler:completionHandler];
     }
     else {
         [self skipBlockedSegment:segment withCompletionHandler:completionHandler];
     }
 }
 
+- (void)executeSeekToTime:(CMTime)time
+      withToleranceBefore:(CMTime)toleranceBefore
+           toleranceAfter:(CMTime)toleranceAfter
+        completionHandler:(void (^)(BOOL))completionHandler
+{
+    [self invalidateDerivedValuesCache];
+
+    [self.player seekToTime:time toleranceBefore:toleranceBefore toleranceAfter:toleranceAfter completionHandler:^(BOOL finished) {
+        // A request arrived while this seek was in flight. Issue the latest one, superseding the current request
+        if (self.pendingSeekTimeValue) {
+            CMTime pendingTime = self.pendingSeekTimeValue.CMTimeValue;
+            CMTime pendingToleranceBefore = self.pendingSeekToleranceBeforeValue.CMTimeValue;
+            CMTime pendingToleranceAfter = self.pendingSeekToleranceAfterValue.CMTimeValue;
+            void (^pendingCompletionHandler)(BOOL) = self.pendingSeekCompletionHandler;
+            [self clearPendingSeek];
+
+            completionHandler ? completionHandler(NO) : nil;
+            [self executeSeekToTime:pendingTime withToleranceBefore:pendingToleranceBefore toleranceAfter:pendingToleranceAfter completionHandler:pendingCompletionHandler];
+            return;
+        }
+
+        if (finished) {
+            [self setPlaybackState:(self.player.rate == 0.f) ? SRGMediaPlayerPlaybackStatePaused : SRGMediaPlayerPlaybackStatePlaying withUserInfo:nil];
+
+            self.seekStartTime = kCMTimeIndefinite;
+            self.seekTargetTime = kCMTimeIndefinite;
+        }
+        completionHandler ? completionHandler(finished) : nil;
+    }];
+}
+
+// Promote the preloaded next item on the live player instance. Called when the current item has played to its end
+- (void)playPreloadedNextMedia
+{
+    AVPlayer *player = self.player;
+
+    NSURL *URL = self.nextContentURL;
+    NSArray<id<SRGSegment>> *segments = self.nextSegments;
+    AVPlayerItem *playerItem = self.nextPlayerItem;
+    [self discardPreloadedNextMedia];
+
+    SRGMediaPlayerLogDebug(@"Controller", @"Promoting preloaded next media %@", URL);
+
+    // Let clients observe the end of the current media before the next one is prepared
+    [self setPlaybackState:SRGMediaPlayerPlaybackStateEnded withUserInfo:nil];
+
+    // Flush telemetry while the ended item is still the current one
+    [self.telemetry stop];
+    self.telemetry = nil;
+
+    self.loadedMediaSelectionGroups = nil;
+
+    _timeRange = kCMTimeRangeInvalid;
+    [self invalidateDerivedValuesCache];
+
+    self.contentURL = URL;
+    self.segments = segments;
+    self.userInfo = nil;
+
+    self.previousSegment = nil;
+    self.targetSegment = nil;
+    self.currentSegment = nil;
+
+    self.startupMetrics = [SRGMediaPlayerStartupMetrics startupMetrics];
+
+    self.startTimeValue = [NSValue valueWithCMTime:kCMTimeZero];
+    @weakify(self)
+    self.startCompletionHandler = ^{
+        @strongify(self)
+        [self play];
+    };
+
+    // Save initial values for restart after a stop
+    self.initialTargetSegment = nil;
+    self.initialStartTimeValue = self.startTimeValue;
+
+    // Swap the item on the live player instance. The parked player bookkeeping moves observers from the ended item
+    // to the promoted one without triggering creation or destruction blocks
+    self.parkedPlayer = player;
+    self.player = nil;
+    [player replaceCurrentItemWithPlayerItem:playerItem];
+    self.player = player;
+    self.parkedPlayer = nil;
+
+    self.telemetry = [[SRGMediaPlayerTelemetry alloc] initWithMediaPlayerController:self];
+    [self.telemetry startWithPlayerItem:playerItem];
+
+    [self setPlaybackState:SRGMediaPlayerPlaybackStatePreparing withUserInfo:nil];
+}
+
+- (void)clearPendingSeek
+{
+    self.pendingSeekTimeValue = nil;
+    self.pendingSeekToleranceBeforeValue = nil;
+    self.pendingSeekToleranceAfterValue = nil;
+    self.pendingSeekCompletionHandler = nil;
+}
+
 - (void)stopWithUserInfo:(NSDictionary *)userInfo
 {
     if (self.pictureInPictureController.isPictureInPictureActive) {
@@ -826,28 +1339,57 @@ withToleranceBefore:(CMTime)toleranceBefore
     }
     
     NSMutableDictionary *fullUserInfo = [userInfo mutableCopy] ?: [NSMutableDictionary dictionary];
-    
+
+    // Flush telemetry while the item is still around
+    [self.telemetry stop];
+    self.telemetry = nil;
+
+    self.loadedMediaSelectionGroups = nil;
+
     // Only reset if needed (this would otherwise lazily instantiate the view again and create potential issues)
     if (self.player) {
         fullUserInfo[SRGMediaPlayerLastPlaybackTimeKey] = [NSValue valueWithCMTime:self.player.currentTime];
         fullUserInfo[SRGMediaPlayerPreviousTimeRangeKey] = [NSValue valueWithCMTimeRange:self.timeRange];
         fullUserInfo[SRGMediaPlayerPreviousMediaTypeKey] = @(self.mediaType);
         fullUserInfo[SRGMediaPlayerPreviousStreamTypeKey] = @(self.streamType);
-        self.player = nil;
+
+        if (self.playerReuseEnabled) {
+            AVPlayer *player = self.player;
+            [player pause];
+            self.parkedPlayer = player;
+            self.player = nil;
+
+            // Remove the item after observers have been unregistered only
+            [player replaceCurrentItemWithPlayerItem:nil];
+        }
+        else {
+            self.parkedPlayer = nil;
+            self.player = nil;
+        }
     }
     
     // The player is guaranteed to be nil when the idle notification is sent
     [self setPlaybackState:SRGMediaPlayerPlaybackStateIdle withUserInfo:[fullUserInfo copy]];
-    
+
     _timeRange = kCMTimeRangeInvalid;
-    
+    [self invalidateDerivedValuesCache];
+
     self.previousSegment = nil;
     self.targetSegment = nil;
     self.currentSegment = nil;
-    
+
     self.startTimeValue = nil;
     self.startCompletionHandler = nil;
-    
+
+    self.pausedByVisibilityPolicy = NO;
+
+    [self discardPreloadedNextMedia];
+
+    // Discard any coalesced seek request, honoring its completion handler contract
+    self.pendingSeekCompletionHandler ? self.pendingSeekCompletionHandler(NO) : nil;
+    [self clearPendingSeek];
+
+    self.seekStartTime = kCMTimeIndefinite;
     self.seekTargetTime = kCMTimeIndefinite;
 }
 
@@ -899,7 +1441,12 @@ withToleranceBefore:(CMTime)toleranceBefore
     
     if (self.previousSegment && ! self.previousSegment.srg_blocked) {
         self.currentSegment = nil;
-        
+
+        // The delegate fast path comes first, a notification broadcast walks the global observer table
+        if ([self.segmentDelegate respondsToSelector:@selector(mediaPlayerController:didEndSegment:interrupted:)]) {
+            [self.segmentDelegate mediaPlayerController:self didEndSegment:self.previousSegment interrupted:interrupted];
+        }
+
         NSMutableDictionary *userInfo = [@{ SRGMediaPlayerSegmentKey : self.previousSegment,
                                             SRGMediaPlayerSelectionKey : @(selected),
                                             SRGMediaPlayerSelectedKey : @(_selected),
@@ -919,9 +1466,13 @@ withToleranceBefore:(CMTime)toleranceBefore
     if (segment) {
         if (! segment.srg_blocked) {
             _selected = selected;
-            
+
             self.currentSegment = segment;
-            
+
+            if ([self.segmentDelegate respondsToSelector:@selector(mediaPlayerController:didStartSegment:selected:)]) {
+                [self.segmentDelegate mediaPlayerController:self didStartSegment:segment selected:_selected];
+            }
+
             NSMutableDictionary *userInfo = [@{ SRGMediaPlayerSegmentKey : segment,
                                                 SRGMediaPlayerSelectionKey : @(_selected),
                                                 SRGMediaPlayerSelectedKey : @(_selected),
@@ -945,18 +1496,53 @@ withToleranceBefore:(CMTime)toleranceBefore
 
 - (id<SRGSegment>)segmentForTime:(CMTime)time
 {
-    if (CMTIME_IS_INVALID(time)) {
-        return nil;
-    }
-    
-    __block id<SRGSegment> locatedSegment = nil;
-    [self.segments enumerateObjectsUsingBlock:^(id<SRGSegment>  _Nonnull segment, NSUInteger idx, BOOL * _Nonnull stop) {
-        if (CMTimeRangeContainsTime(segment.srg_timeRange, time)) {
-            locatedSegment = segment;
-            *stop = YES;
-        }
+    return [self.segmentIndex segmentAtTime:time];
+}
+
+- (CMTime)firstNonBlockedTimeAfterTime:(CMTime)time
+{
+    return self.segmentIndex ? [self.segmentIndex firstNonBlockedTimeAfterTime:time] : time;
+}
+
+#pragma mark Media selection
+
+- (void)loadMediaSelectionGroupsForPlayerItem:(AVPlayerItem *)playerItem
+{
+    AVAsset *asset = playerItem.asset;
+
+    // Media selection information is loaded asynchronously. Reading the groups synchronously (e.g. when the tracks
+    // user interface opens) would block the main thread until the asset has loaded them
+    @weakify(self)
+    [asset loadValuesAsynchronouslyForKeys:@[ @"availableMediaCharacteristicsWithMediaSelectionOptions" ] completionHandler:^{
+        dispatch_async(dispatch_get_main_queue(), ^{
+            @strongify(self)
+
+            // Discard the result if playback has moved to another item in the meantime
+            if (self.player.currentItem != playerItem) {
+                return;
+            }
+
+            if ([asset statusOfValueForKey:@"availableMediaCharacteristicsWithMediaSelectionOptions" error:NULL] != AVKeyValueStatusLoaded) {
+                return;
+            }
+
+            NSMutableDictionary<NSString *, AVMediaSelectionGroup *> *mediaSelectionGroups = [NSMutableDictionary dictionary];
+            for (NSString *characteristic in asset.availableMediaCharacteristicsWithMediaSelectionOptions) {
+                AVMediaSelectionGroup *group = [asset mediaSelectionGroupForMediaCharacteristic:characteristic];
+                if (group) {
+                    mediaSelectionGroups[characteristic] = group;
+                }
+            }
+            self.loadedMediaSelectionGroups = [mediaSelectionGroups copy];
+
+            [[NSNotificationCenter defaultCenter] postNotificationName:SRGMediaPlayerMediaSelectionGroupsDidBecomeAvailableNotification object:self];
+        });
     }];
-    return locatedSegment;
+}
+
+- (AVMediaSelectionGroup *)mediaSelectionGroupForMediaCharacteristic:(NSString *)characteristic
+{
+    return self.loadedMediaSelectionGroups[characteristic];
 }
 
 // No tolerance parameters here. When skipping blocked segments, we want to resume sharply at segment end
@@ -996,8 +1582,15 @@ withToleranceBefore:(CMTime)toleranceBefore
 
 - (void)updatePictureInPictureController
 {
-    if (self.playerLayer.readyForDisplay) {
-        self.pictureInPictureController = [[AVPictureInPictureController alloc] initWithPlayerLayer:self.playerLayer];
+    AVPlayerLayer *playerLayer = self.playerLayer;
+    if (playerLayer.readyForDisplay) {
+        // Keep an existing controller wired to this layer warm (with its KVO registrations), instead of rebuilding
+        // it each time the layer reports being ready again. PiP activations therefore never pay construction cost
+        if (_pictureInPictureController.playerLayer == playerLayer) {
+            return;
+        }
+
+        self.pictureInPictureController = [[AVPictureInPictureController alloc] initWithPlayerLayer:playerLayer];
         self.pictureInPictureControllerCreationBlock ? self.pictureInPictureControllerCreationBlock(_pictureInPictureController) : nil;
     }
     else {
@@ -1009,14 +1602,15 @@ withToleranceBefore:(CMTime)toleranceBefore
 
 - (void)registerTimeObserversForPlayer:(AVPlayer *)player
 {
-    for (SRGPeriodicTimeObserver *playbackBlockRegistration in [self.periodicTimeObservers allValues]) {
-        [playbackBlockRegistration attachToMediaPlayer:player];
+    for (SRGPeriodicTimeObserver *periodicTimeObserver in self.periodicTimeObservers) {
+        [periodicTimeObserver attachToMediaPlayer:player];
     }
     
     @weakify(self)
     self.segmentPeriodicTimeObserver = [player addPeriodicTimeObserverForInterval:CMTimeMakeWithSeconds(0.1, NSEC_PER_SEC) queue:NULL usingBlock:^(CMTime time) {
         @strongify(self)
         [self updateSegmentStatusForPlaybackState:self.playbackState previousPlaybackState:self.playbackState time:time];
+        [self updatePlaybackSnapshotForPlaybackState:self.playbackState time:time];
     }];
 }
 
@@ -1025,7 +1619,7 @@ withToleranceBefore:(CMTime)toleranceBefore
     [player removeTimeObserver:self.segmentPeriodicTimeObserver];
     self.segmentPeriodicTimeObserver = nil;
     
-    for (SRGPeriodicTimeObserver *periodicTimeObserver in [self.periodicTimeObservers allValues]) {
+    for (SRGPeriodicTimeObserver *periodicTimeObserver in self.periodicTimeObservers) {
         [periodicTimeObserver detachFromMediaPlayer];
     }
 }
@@ -1036,53 +1630,107 @@ withToleranceBefore:(CMTime)toleranceBefore
         return nil;
     }
     
-    NSString *identifier = [[NSUUID UUID] UUIDString];
     SRGPeriodicTimeObserver *periodicTimeObserver = [self periodicTimeObserverForInterval:interval queue:queue];
-    [periodicTimeObserver setBlock:block forIdentifier:identifier];
-    
+    SRGPeriodicTimeObserverToken *token = [periodicTimeObserver addBlock:block];
+
     if (self.player) {
         [periodicTimeObserver attachToMediaPlayer:self.player];
     }
-    
-    // Return the opaque identifier
-    return identifier;
+
+    // Return the opaque token
+    return token;
 }
 
 - (void)removePeriodicTimeObserver:(id)observer
 {
-    if (! observer) {
+    if (! [observer isKindOfClass:SRGPeriodicTimeObserverToken.class]) {
         return;
     }
-    
-    for (NSString *key in self.periodicTimeObservers.allKeys) {
-        SRGPeriodicTimeObserver *periodicTimeObserver = self.periodicTimeObservers[key];
-        if (! [periodicTimeObserver hasBlockWithIdentifier:observer]) {
-            continue;
-        }
-            
-        [periodicTimeObserver removeBlockWithIdentifier:observer];
-        
-        // Remove the periodic time observer if not used anymore
-        if (periodicTimeObserver.registrationCount == 0) {
-            [self.periodicTimeObservers removeObjectForKey:key];
-            return;
-        }
+
+    SRGPeriodicTimeObserverToken *token = observer;
+    SRGPeriodicTimeObserver *periodicTimeObserver = token.periodicTimeObserver;
+    if (! periodicTimeObserver) {
+        return;
+    }
+
+    [periodicTimeObserver removeBlockWithToken:token];
+
+    // Remove the periodic time observer if not used anymore
+    if (periodicTimeObserver.registrationCount == 0) {
+        [periodicTimeObserver detachFromMediaPlayer];
+        [self.periodicTimeObservers removeObjectIdenticalTo:periodicTimeObserver];
     }
 }
 
 - (SRGPeriodicTimeObserver *)periodicTimeObserverForInterval:(CMTime)interval queue:(dispatch_queue_t)queue
 {
-    NSString *key = [NSString stringWithFormat:@"%@-%@-%@-%@-%p", @(interval.value), @(interval.timescale), @(interval.flags), @(interval.epoch), queue];
-    SRGPeriodicTimeObserver *periodicTimeObserver = self.periodicTimeObservers[key];
-    
-    if (! periodicTimeObserver) {
-        periodicTimeObserver = [[SRGPeriodicTimeObserver alloc] initWithInterval:interval queue:queue];
-        self.periodicTimeObservers[key] = periodicTimeObserver;
+    dispatch_queue_t effectiveQueue = queue ?: dispatch_get_main_queue();
+    for (SRGPeriodicTimeObserver *periodicTimeObserver in self.periodicTimeObservers) {
+        if (CMTimeCompare(periodicTimeObserver.interval, interval) == 0 && periodicTimeObserver.queue == effectiveQueue) {
+            return periodicTimeObserver;
+        }
     }
-    
+
+    SRGPeriodicTimeObserver *periodicTimeObserver = [[SRGPeriodicTimeObserver alloc] initWithInterval:interval queue:queue];
+    periodicTimeObserver.relaxed = [self shouldRelaxObserverCadenceForPlaybackState:self.playbackState];
+    [self.periodicTimeObservers addObject:periodicTimeObserver];
     return periodicTimeObserver;
 }
 
+- (BOOL)shouldRelaxObserverCadenceForPlaybackState:(SRGMediaPlayerPlaybackState)playbackState
+{
+    return self.observerCadenceAdaptive
+        && (playbackState == SRGMediaPlayerPlaybackStatePaused
+                || playbackState == SRGMediaPlayerPlaybackStateIdle
+                || playbackState == SRGMediaPlayerPlaybackStateEnded);
+}
+
+- (void)updateObserverCadenceForPlaybackState:(SRGMediaPlayerPlaybackState)playbackState
+{
+    BOOL relaxed = [self shouldRelaxObserverCadenceForPlaybackState:playbackState];
+    for (SRGPeriodicTimeObserver *periodicTimeObserver in self.periodicTimeObservers) {
+        periodicTimeObserver.relaxed = relaxed;
+    }
+}
+
+- (void)updatePlaybackSnapshotForPlaybackState:(SRGMediaPlayerPlaybackState)playbackState time:(CMTime)time
+{
+    NSUInteger segmentIndex = self.currentSegment ? [self.segmentIndex indexOfSegment:self.currentSegment] : NSNotFound;
+    self.playbackSnapshot = [SRGMediaPlayerPlaybackSnapshot snapshotWithPlaybackState:playbackState
+                                                                                 time:time
+                                                                            timeRange:self.timeRange
+                                                                         segmentIndex:segmentIndex];
+}
+
+#pragma mark SRGMediaPlayerViewVisibilityDelegate protocol
+
+- (void)mediaPlayerView:(SRGMediaPlayerView *)mediaPlayerView didChangeVisibility:(BOOL)visible
+{
+    switch (self.viewVisibilityPolicy) {
+        case SRGMediaPlayerViewVisibilityPolicyDetachRendering: {
+            // Disconnecting the player from its layer suspends video decoding only, audio playback continues
+            mediaPlayerView.playerLayer.player = visible ? self.player : nil;
+            break;
+        }
+
+        case SRGMediaPlayerViewVisibilityPolicyPause: {
+            if (! visible && self.playbackState == SRGMediaPlayerPlaybackStatePlaying) {
+                self.pausedByVisibilityPolicy = YES;
+                [self pause];
+            }
+            else if (visible && self.pausedByVisibilityPolicy) {
+                self.pausedByVisibilityPolicy = NO;
+                [self play];
+            }
+            break;
+        }
+
+        default: {
+            break;
+        }
+    }
+}
+
 #pragma mark Notifications
 
 - (void)srg_mediaPlayerController_playerItemPlaybackStalled:(NSNotification *)notification
@@ -1092,7 +1740,12 @@ withToleranceBefore:(CMTime)toleranceBefore
 
 - (void)srg_mediaPlayerController_playerItemDidPlayToEndTime:(NSNotification *)notification
 {
-    [self setPlaybackState:SRGMediaPlayerPlaybackStateEnded withUserInfo:nil];
+    if (self.nextPlayerItem) {
+        [self playPreloadedNextMedia];
+    }
+    else {
+        [self setPlaybackState:SRGMediaPlayerPlaybackStateEnded withUserInfo:nil];
+    }
 }
 
 - (void)srg_mediaPlayerController_playerItemFailedToPlayToEndTime:(NSNotification *)notification
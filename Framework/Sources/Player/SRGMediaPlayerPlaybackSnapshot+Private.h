@@ -0,0 +1,26 @@
+//
+//  Copyright (c) SRG SSR. All rights reserved.
+//
+//  License information is available from the LICENSE file.
+//
+
+#import "SRGMediaPlayerPlaybackSnapshot.h"
+
+NS_ASSUME_NONNULL_BEGIN
+
+/**
+ *  Private interface for internal use.
+ */
+@interface SRGMediaPlayerPlaybackSnapshot (Private)
+
+/**
+ *  Create a snapshot capturing the supplied values at the current date.
+ */
++ (SRGMediaPlayerPlaybackSnapshot *)snapshotWithPlaybackState:(SRGMediaPlayerPlaybackState)playbackState
+                                                         time:(CMTime)time
+                                                    timeRange:(CMTimeRange)timeRange
+                                                 segmentIndex:(NSUInteger)segmentIndex;
+
+@end
+
+NS_ASSUME_NONNULL_END
@@ -0,0 +1,59 @@
+//
+//  Copyright (c) SRG SSR. All rights reserved.
+//
+//  License information is available from the LICENSE file.
+//
+
+#import "SRGMediaPlayerConstants.h"
+
+#import <CoreMedia/CoreMedia.h>
+#import <Foundation/Foundation.h>
+
+NS_ASSUME_NONNULL_BEGIN
+
+/**
+ *  Immutable snapshot of the playback status of an `SRGMediaPlayerController`, atomically published by the
+ *  controller on each playback state transition and observation tick (see its `playbackSnapshot` property).
+ *
+ *  Unlike `playbackState`, `currentTime` or `timeRange`, which must be read on the main thread, a snapshot can be
+ *  read from any thread without locks or main-queue hops, which makes it suitable for background consumers such as
+ *  analytics or watch-progress writers. All values were captured at the same instant (`date`), so they are
+ *  mutually consistent; `time` can be extrapolated with the age of the snapshot if needed.
+ */
+@interface SRGMediaPlayerPlaybackSnapshot : NSObject
+
+/**
+ *  The playback state when the snapshot was captured.
+ */
+@property (nonatomic, readonly) SRGMediaPlayerPlaybackState playbackState;
+
+/**
+ *  The playback position when the snapshot was captured.
+ */
+@property (nonatomic, readonly) CMTime time;
+
+/**
+ *  The media time range when the snapshot was captured (might be empty or indefinite).
+ */
+@property (nonatomic, readonly) CMTimeRange timeRange;
+
+/**
+ *  The date at which the snapshot was captured.
+ */
+@property (nonatomic, readonly) NSDate *date;
+
+/**
+ *  The index of the current segment in the segment list supplied at playback start, `NSNotFound` if playback was
+ *  not within a segment when the snapshot was captured (or no segments were supplied).
+ */
+@property (nonatomic, readonly) NSUInteger segmentIndex;
+
+@end
+
+@interface SRGMediaPlayerPlaybackSnapshot (Unavailable)
+
+- (instancetype)init NS_UNAVAILABLE;
+
+@end
+
+NS_ASSUME_NONNULL_END
@@ -0,0 +1,53 @@
+//
+//  Copyright (c) SRG SSR. All rights reserved.
+//
+//  License information is available from the LICENSE file.
+//
+
+#import "SRGMediaPlayerPlaybackSnapshot.h"
+#import "SRGMediaPlayerPlaybackSnapshot+Private.h"
+
+@interface SRGMediaPlayerPlaybackSnapshot ()
+
+@property (nonatomic) SRGMediaPlayerPlaybackState playbackState;
+@property (nonatomic) CMTime time;
+@property (nonatomic) CMTimeRange timeRange;
+@property (nonatomic) NSDate *date;
+@property (nonatomic) NSUInteger segmentIndex;
+
+@end
+
+@implementation SRGMediaPlayerPlaybackSnapshot
+
+#pragma mark Description
+
+- (NSString *)description
+{
+    return [NSString stringWithFormat:@"<%@: %p; playbackState: %@; time: %@; date: %@; segmentIndex: %@>",
+            [self class],
+            self,
+            @(self.playbackState),
+            @(CMTimeGetSeconds(self.time)),
+            self.date,
+            self.segmentIndex != NSNotFound ? @(self.segmentIndex) : @"none"];
+}
+
+@end
+
+@implementation SRGMediaPlayerPlaybackSnapshot (Private)
+
++ (SRGMediaPlayerPlaybackSnapshot *)snapshotWithPlaybackState:(SRGMediaPlayerPlaybackState)playbackState
+                                                         time:(CMTime)time
+                                                    timeRange:(CMTimeRange)timeRange
+                                                 segmentIndex:(NSUInteger)segmentIndex
+{
+    SRGMediaPlayerPlaybackSnapshot *snapshot = [[SRGMediaPlayerPlaybackSnapshot alloc] init];
+    snapshot.playbackState = playbackState;
+    snapshot.time = time;
+    snapshot.timeRange = timeRange;
+    snapshot.date = [NSDate date];
+    snapshot.segmentIndex = segmentIndex;
+    return snapshot;
+}
+
+@end
@@ -0,0 +1,31 @@
+//
+//  Copyright (c) SRG SSR. All rights reserved.
+//
+//  License information is available from the LICENSE file.
+//
+
+#import "SRGMediaPlayerPlaybackStateChange.h"
+
+NS_ASSUME_NONNULL_BEGIN
+
+/**
+ *  Private interface for internal use.
+ */
+@interface SRGMediaPlayerPlaybackStateChange (Private)
+
+/**
+ *  Return a payload with the specified values, recycled from the pool if possible. Must be called from the main
+ *  thread.
+ */
++ (SRGMediaPlayerPlaybackStateChange *)changeWithPlaybackState:(SRGMediaPlayerPlaybackState)playbackState
+                                         previousPlaybackState:(SRGMediaPlayerPlaybackState)previousPlaybackState
+                                                      selected:(BOOL)selected;
+
+/**
+ *  Return the payload to the pool, once its notification callout is over. Must be called from the main thread.
+ */
+- (void)srg_recycle;
+
+@end
+
+NS_ASSUME_NONNULL_END
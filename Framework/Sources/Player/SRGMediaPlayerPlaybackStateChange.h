@@ -0,0 +1,48 @@
+//
+//  Copyright (c) SRG SSR. All rights reserved.
+//
+//  License information is available from the LICENSE file.
+//
+
+#import "SRGMediaPlayerConstants.h"
+
+#import <Foundation/Foundation.h>
+
+NS_ASSUME_NONNULL_BEGIN
+
+/**
+ *  Typed payload describing a playback state transition, attached to each
+ *  `SRGMediaPlayerPlaybackStateDidChangeNotification` under the `SRGMediaPlayerPlaybackStateChangeKey`. Unlike the
+ *  boxed values found under the individual `userInfo` keys, the payload exposes plain typed properties, and its
+ *  instances are recycled from a pool, so high-frequency consumers can read state changes without per-event
+ *  small-object churn.
+ *
+ *  Because of pooling, a payload is only valid for the duration of the notification callout it was delivered with.
+ *  Copy it (the class conforms to `NSCopying`) to keep the values beyond the callout.
+ */
+@interface SRGMediaPlayerPlaybackStateChange : NSObject <NSCopying>
+
+/**
+ *  The playback state after the transition.
+ */
+@property (nonatomic, readonly) SRGMediaPlayerPlaybackState playbackState;
+
+/**
+ *  The playback state before the transition.
+ */
+@property (nonatomic, readonly) SRGMediaPlayerPlaybackState previousPlaybackState;
+
+/**
+ *  `YES` iff the transition results from a segment selection.
+ */
+@property (nonatomic, readonly, getter=isSelected) BOOL selected;
+
+@end
+
+@interface SRGMediaPlayerPlaybackStateChange (Unavailable)
+
+- (instancetype)init NS_UNAVAILABLE;
+
+@end
+
+NS_ASSUME_NONNULL_END
@@ -0,0 +1,93 @@
+//
+//  Copyright (c) SRG SSR. All rights reserved.
+//
+//  License information is available from the LICENSE file.
+//
+
+#import "SRGMediaPlayerPlaybackStateChange.h"
+#import "SRGMediaPlayerPlaybackStateChange+Private.h"
+
+// Number of payloads kept for reuse. Transitions are delivered one at a time on the main thread, a small pool
+// suffices (nested transitions triggered from within a callout each take their own instance)
+static const NSUInteger SRGMediaPlayerPlaybackStateChangePoolCapacity = 4;
+
+static NSMutableArray<SRGMediaPlayerPlaybackStateChange *> *SRGMediaPlayerPlaybackStateChangePool(void)
+{
+    static NSMutableArray *s_pool;
+    static dispatch_once_t s_onceToken;
+    dispatch_once(&s_onceToken, ^{
+        s_pool = [NSMutableArray array];
+    });
+    return s_pool;
+}
+
+@interface SRGMediaPlayerPlaybackStateChange ()
+
+@property (nonatomic) SRGMediaPlayerPlaybackState playbackState;
+@property (nonatomic) SRGMediaPlayerPlaybackState previousPlaybackState;
+@property (nonatomic, getter=isSelected) BOOL selected;
+
+@end
+
+@implementation SRGMediaPlayerPlaybackStateChange
+
+#pragma mark NSCopying protocol
+
+- (id)copyWithZone:(NSZone *)zone
+{
+    // Copies are snapshots owned by the caller, never returned to the pool
+    SRGMediaPlayerPlaybackStateChange *change = [[[self class] allocWithZone:zone] init];
+    change.playbackState = self.playbackState;
+    change.previousPlaybackState = self.previousPlaybackState;
+    change.selected = self.selected;
+    return change;
+}
+
+#pragma mark Description
+
+- (NSString *)description
+{
+    return [NSString stringWithFormat:@"<%@: %p; playbackState: %@; previousPlaybackState: %@; selected: %@>",
+            [self class],
+            self,
+            @(self.playbackState),
+            @(self.previousPlaybackState),
+            self.selected ? @"YES" : @"NO"];
+}
+
+@end
+
+@implementation SRGMediaPlayerPlaybackStateChange (Private)
+
++ (SRGMediaPlayerPlaybackStateChange *)changeWithPlaybackState:(SRGMediaPlayerPlaybackState)playbackState
+                                         previousPlaybackState:(SRGMediaPlayerPlaybackState)previousPlaybackState
+                                                      selected:(BOOL)selected
+{
+    NSAssert([NSThread isMainThread], @"Must be called from the main thread");
+
+    NSMutableArray<SRGMediaPlayerPlaybackStateChange *> *pool = SRGMediaPlayerPlaybackStateChangePool();
+    SRGMediaPlayerPlaybackStateChange *change = pool.lastObject;
+    if (change) {
+        [pool removeLastObject];
+    }
+    else {
+        change = [[SRGMediaPlayerPlaybackStateChange alloc] init];
+    }
+
+    change.playbackState = playbackState;
+    change.previousPlaybackState = previousPlaybackState;
+    change.selected = selected;
+    return change;
+}
+
+- (void)srg_recycle
+{
+    NSAssert([NSThread isMainThread], @"Must be called from the main thread");
+
+    NSMutableArray<SRGMediaPlayerPlaybackStateChange *> *pool = SRGMediaPlayerPlaybackStateChangePool();
+    if (pool.count < SRGMediaPlayerPlaybackStateChangePoolCapacity) {
+        [pool addObject:self];
+    }
+}
+
+@end
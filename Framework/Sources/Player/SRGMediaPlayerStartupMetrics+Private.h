@@ -0,0 +1,30 @@
+//
+//  Copyright (c) SRG SSR. All rights reserved.
+//
+//  License information is available from the LICENSE file.
+//
+
+#import "SRGMediaPlayerStartupMetrics.h"
+
+NS_ASSUME_NONNULL_BEGIN
+
+/**
+ *  Private interface for internal use.
+ */
+@interface SRGMediaPlayerStartupMetrics (Private)
+
+/**
+ *  Create metrics whose reference timestamp is the current time.
+ */
++ (SRGMediaPlayerStartupMetrics *)startupMetrics;
+
+/**
+ *  Record phases. Each phase is recorded at most once, later calls are ignored.
+ */
+- (void)recordItemReady;
+- (void)recordFirstFrame;
+- (void)recordPlaying;
+
+@end
+
+NS_ASSUME_NONNULL_END
@@ -0,0 +1,51 @@
+//
+//  Copyright (c) SRG SSR. All rights reserved.
+//
+//  License information is available from the LICENSE file.
+//
+
+#import <Foundation/Foundation.h>
+
+NS_ASSUME_NONNULL_BEGIN
+
+/**
+ *  Timestamps collected while a media is being prepared for playback, measuring how long each startup phase took.
+ *  A fresh instance is associated with an `SRGMediaPlayerController` every time a playback request is made, and can
+ *  be retrieved from its `startupMetrics` property at any time.
+ *
+ *  Intervals are measured with a monotonic clock from the moment the URL was handed over to the controller. An
+ *  interval is negative as long as the corresponding phase has not been reached. Once all phases have been reached
+ *  an `SRGMediaPlayerStartupMetricsDidBecomeAvailableNotification` is sent by the associated controller.
+ */
+@interface SRGMediaPlayerStartupMetrics : NSObject
+
+/**
+ *  The date at which playback was requested (i.e. the URL was set).
+ */
+@property (nonatomic, readonly) NSDate *preparationDate;
+
+/**
+ *  The time elapsed between the playback request and the moment the player item was ready to play.
+ */
+@property (nonatomic, readonly) NSTimeInterval itemReadyInterval;
+
+/**
+ *  The time elapsed between the playback request and the moment the first frame was ready for display. Remains
+ *  negative for audio-only medias.
+ */
+@property (nonatomic, readonly) NSTimeInterval firstFrameInterval;
+
+/**
+ *  The time elapsed between the playback request and the moment playback effectively started.
+ */
+@property (nonatomic, readonly) NSTimeInterval playingInterval;
+
+@end
+
+@interface SRGMediaPlayerStartupMetrics (Unavailable)
+
+- (instancetype)init NS_UNAVAILABLE;
+
+@end
+
+NS_ASSUME_NONNULL_END
@@ -0,0 +1,85 @@
+//
+//  Copyright (c) SRG SSR. All rights reserved.
+//
+//  License information is available from the LICENSE file.
+//
+
+#import "SRGMediaPlayerStartupMetrics.h"
+
+#import "SRGMediaPlayerStartupMetrics+Private.h"
+
+@interface SRGMediaPlayerStartupMetrics ()
+
+@property (nonatomic) NSDate *preparationDate;
+
+@property (nonatomic) NSTimeInterval itemReadyInterval;
+@property (nonatomic) NSTimeInterval firstFrameInterval;
+@property (nonatomic) NSTimeInterval playingInterval;
+
+@end
+
+@implementation SRGMediaPlayerStartupMetrics {
+@private
+    // Monotonic reference, not subject to wall clock adjustments
+    NSTimeInterval _referenceUptime;
+}
+
+#pragma mark Class methods
+
++ (SRGMediaPlayerStartupMetrics *)startupMetrics
+{
+    return [[SRGMediaPlayerStartupMetrics alloc] init];
+}
+
+#pragma mark Object lifecycle
+
+- (instancetype)init
+{
+    if (self = [super init]) {
+        self.preparationDate = [NSDate date];
+        _referenceUptime = NSProcessInfo.processInfo.systemUptime;
+
+        self.itemReadyInterval = -1.;
+        self.firstFrameInterval = -1.;
+        self.playingInterval = -1.;
+    }
+    return self;
+}
+
+#pragma mark Phase recording
+
+- (void)recordItemReady
+{
+    if (self.itemReadyInterval < 0.) {
+        self.itemReadyInterval = NSProcessInfo.processInfo.systemUptime - _referenceUptime;
+    }
+}
+
+- (void)recordFirstFrame
+{
+    if (self.firstFrameInterval < 0.) {
+        self.firstFrameInterval = NSProcessInfo.processInfo.systemUptime - _referenceUptime;
+    }
+}
+
+- (void)recordPlaying
+{
+    if (self.playingInterval < 0.) {
+        self.playingInterval = NSProcessInfo.processInfo.systemUptime - _referenceUptime;
+    }
+}
+
+#pragma mark Description
+
+- (NSString *)description
+{
+    return [NSString stringWithFormat:@"<%@: %p; preparationDate: %@; itemReadyInterval: %@; firstFrameInterval: %@; playingInterval: %@>",
+            [self class],
+            self,
+            self.preparationDate,
+            @(self.itemReadyInterval),
+            @(self.firstFrameInterval),
+            @(self.playingInterval)];
+}
+
+@end
@@ -51,6 +51,9 @@ static SRGMediaPlayerSharedController *s_mediaPlayerController = nil;
 
 @property (nonatomic, weak) id periodicTimeObserver;
 
+// Set when the deferred interface setup pass has been scheduled (see -viewDidLayoutSubviews)
+@property (nonatomic, getter=isDeferredSetupScheduled) BOOL deferredSetupScheduled;
+
 @end
 
 @implementation SRGMediaPlayerViewController {
@@ -125,53 +128,77 @@ static SRGMediaPlayerSharedController *s_mediaPlayerController = nil;
     s_mediaPlayerController.view.frame = self.playerView.bounds;
     s_mediaPlayerController.view.autoresizingMask = UIViewAutoresizingFlexibleWidth | UIViewAutoresizingFlexibleHeight;
     [self.playerView addSubview:s_mediaPlayerController.view];
-    
+
+    // Critical path only: the player view and the primary controls the user sees first. Secondary overlay bindings
+    // and gesture setup are deferred until after the first layout pass (see -viewDidLayoutSubviews), so that the
+    // presentation animation is not delayed by their registration work
+    self.playbackActivityIndicatorView.mediaPlayerController = s_mediaPlayerController;
+    self.playPauseButton.mediaPlayerController = s_mediaPlayerController;
+
+    [self updateTopBar];
+
+    [self resetInactivityTimer];
+}
+
+- (void)viewDidLayoutSubviews
+{
+    [super viewDidLayoutSubviews];
+
+    // Schedule once, on the next run-loop turn, so that the first frame has been rendered before the deferred
+    // pass runs
+    if (! self.deferredSetupScheduled) {
+        self.deferredSetupScheduled = YES;
+        dispatch_async(dispatch_get_main_queue(), ^{
+            [self finishDeferredSetup];
+        });
+    }
+}
+
+// Deferred interface pass: secondary overlays and gestures which are not needed for the first rendered frame
+- (void)finishDeferredSetup
+{
     UITapGestureRecognizer *doubleTapGestureRecognizer = [[UITapGestureRecognizer alloc] initWithTarget:self action:@selector(handleDoubleTap:)];
     doubleTapGestureRecognizer.numberOfTapsRequired = 2;
     [self.playerView addGestureRecognizer:doubleTapGestureRecognizer];
-    
+
     UITapGestureRecognizer *singleTapGestureRecognizer = [[UITapGestureRecognizer alloc] initWithTarget:self action:@selector(handleSingleTap:)];
     [singleTapGestureRecognizer requireGestureRecognizerToFail:doubleTapGestureRecognizer];
     [self.playerView addGestureRecognizer:singleTapGestureRecognizer];
-    
+
     SRGActivityGestureRecognizer *activityGestureRecognizer = [[SRGActivityGestureRecognizer alloc] initWithTarget:self action:@selector(resetInactivityTimer:)];
     activityGestureRecognizer.delegate = self;
     [self.view addGestureRecognizer:activityGestureRecognizer];
-    
+
     self.pictureInPictureButton.mediaPlayerController = s_mediaPlayerController;
     self.tracksButton.mediaPlayerController = s_mediaPlayerController;
-    self.playbackActivityIndicatorView.mediaPlayerController = s_mediaPlayerController;
     self.timeSlider.mediaPlayerController = s_mediaPlayerController;
-    self.playPauseButton.mediaPlayerController = s_mediaPlayerController;
     self.airplayButton.mediaPlayerController = s_mediaPlayerController;
     self.airplayView.mediaPlayerController = s_mediaPlayerController;
-    
+
     [self.liveButton setTitle:SRGMediaPlayerLocalizedString(@"Back to live", @"Button title to go back to live") forState:UIControlStateNormal];
     self.liveButton.accessibilityLabel = SRGMediaPlayerAccessibilityLocalizedString(@"Back to live", @"Back to live label");
     self.liveButton.hidden = YES;
-    
+
     self.liveButton.layer.borderColor = [UIColor whiteColor].CGColor;
     self.liveButton.layer.borderWidth = 1.f;
-    
+
     @weakify(self)
     self.periodicTimeObserver = [s_mediaPlayerController addPeriodicTimeObserverForInterval: CMTimeMakeWithSeconds(1., NSEC_PER_SEC) queue: NULL usingBlock:^(CMTime time) {
         @strongify(self)
-        
+
         if (s_mediaPlayerController.streamType != SRGMediaPlayerStreamTypeUnknown) {
             CGFloat labelWidth = (CMTimeGetSeconds(s_mediaPlayerController.timeRange.duration) >= 60. * 60.) ? 56.f : 45.f;
             self.valueLabelWidthConstraint.constant = labelWidth;
             self.timeLeftValueLabelWidthConstraint.constant = labelWidth;
-            
+
             if (s_mediaPlayerController.playbackState != SRGMediaPlayerPlaybackStateSeeking) {
                 [self updateLiveButton];
             }
         }
-        
+
         [self updateTopBar];
     }];
     [self updateTopBar];
-    
-    [self resetInactivityTimer];
 }
 
 - (void)viewDidAppear:(BOOL)animated
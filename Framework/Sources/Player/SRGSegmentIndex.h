@@ -0,0 +1,98 @@
+//
+//  Copyright (c) SRG SSR. All rights reserved.
+//
+//  License information is available from the LICENSE file.
+//
+
+#import "SRGSegment.h"
+
+#import <CoreMedia/CoreMedia.h>
+#import <Foundation/Foundation.h>
+
+NS_ASSUME_NONNULL_BEGIN
+
+/**
+ *  A sorted interval index over a segment list, answering time-based lookups in logarithmic time. Intended for large
+ *  timelines (e.g. EPG-style streams with thousands of segments), for which linear scans on every playback tick are
+ *  too expensive.
+ *
+ *  The index is immutable and built once from the segment list it is given. If several segments overlap at a given
+ *  time, the one appearing first in the original list wins, matching the behavior of a linear scan.
+ */
+@interface SRGSegmentIndex : NSObject
+
+/**
+ *  Create an index from a segment list. The original list order is preserved and used for index-based lookups.
+ *
+ *  @param segments The segments to index (can be empty).
+ */
+- (instancetype)initWithSegments:(NSArray<id<SRGSegment>> *)segments NS_DESIGNATED_INITIALIZER;
+
+/**
+ *  The segments the index was built from, in their original order.
+ */
+@property (nonatomic, readonly) NSArray<id<SRGSegment>> *segments;
+
+/**
+ *  The non-hidden segments, in their original order. Computed once when the index is built (no predicate evaluation
+ *  or filtering is involved afterwards).
+ */
+@property (nonatomic, readonly) NSArray<id<SRGSegment>> *visibleSegments;
+
+/**
+ *  Return the segment whose time range contains the specified time, `nil` if none.
+ */
+- (nullable id<SRGSegment>)segmentAtTime:(CMTime)time;
+
+/**
+ *  Return the index of the specified segment in the original segment list, `NSNotFound` if the segment does not
+ *  belong to it.
+ */
+- (NSUInteger)indexOfSegment:(id<SRGSegment>)segment;
+
+/**
+ *  Return `YES` iff the specified segment belongs to the original segment list.
+ */
+- (BOOL)containsSegment:(id<SRGSegment>)segment;
+
+/**
+ *  Return the index of the specified segment in the visible segment list, `NSNotFound` if the segment is hidden or
+ *  does not belong to the original segment list.
+ */
+- (NSUInteger)indexOfVisibleSegment:(id<SRGSegment>)segment;
+
+/**
+ *  Translate an index in the visible segment list into the corresponding index in the original segment list,
+ *  `NSNotFound` if the index is invalid.
+ */
+- (NSUInteger)segmentIndexForVisibleSegmentIndex:(NSUInteger)visibleSegmentIndex;
+
+/**
+ *  Translate an index in the original segment list into the corresponding index in the visible segment list,
+ *  `NSNotFound` if the index is invalid or the segment is hidden.
+ */
+- (NSUInteger)visibleSegmentIndexForSegmentIndex:(NSUInteger)segmentIndex;
+
+/**
+ *  Return `YES` iff the specified time falls within a blocked segment. Answered against a merged sorted list of
+ *  blocked time ranges built when the index is created, which makes the check cheaper than a segment lookup (no
+ *  segment object is touched).
+ */
+- (BOOL)isTimeBlocked:(CMTime)time;
+
+/**
+ *  Return the first time at or after the specified time which does not fall within a blocked segment. Since blocked
+ *  ranges are merged, a run of contiguous or overlapping blocked segments is cleared with a single query. Returns
+ *  the specified time if it is not blocked.
+ */
+- (CMTime)firstNonBlockedTimeAfterTime:(CMTime)time;
+
+@end
+
+@interface SRGSegmentIndex (Unavailable)
+
+- (instancetype)init NS_UNAVAILABLE;
+
+@end
+
+NS_ASSUME_NONNULL_END
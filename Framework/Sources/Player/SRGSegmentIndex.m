@@ -0,0 +1,291 @@
+//
+//  Copyright (c) SRG SSR. All rights reserved.
+//
+//  License information is available from the LICENSE file.
+//
+
+#import "SRGSegmentIndex.h"
+
+@interface SRGSegmentIndex () {
+@private
+    // Parallel arrays sorted by segment start time (ties broken by original position). The cumulative maximum of
+    // segment end times makes backward scans over overlapping segments terminate as early as possible.
+    CMTime *_starts;
+    CMTime *_cumulativeMaxEnds;
+    NSUInteger *_originalIndexes;
+    NSUInteger _count;
+
+    // Index translation tables between the original and visible segment lists
+    NSUInteger *_visibleIndexesBySegmentIndex;
+    NSUInteger *_segmentIndexesByVisibleIndex;
+
+    // Merged sorted blocked time ranges (overlapping and contiguous blocked segments collapse into a single range)
+    CMTimeRange *_blockedRanges;
+    NSUInteger _blockedRangesCount;
+}
+
+@property (nonatomic) NSArray<id<SRGSegment>> *segments;
+@property (nonatomic) NSArray<id<SRGSegment>> *visibleSegments;
+@property (nonatomic) NSArray<id<SRGSegment>> *sortedSegments;
+@property (nonatomic) NSMapTable<id<SRGSegment>, NSNumber *> *indexesBySegment;
+
+@end
+
+@implementation SRGSegmentIndex
+
+#pragma mark Object lifecycle
+
+- (instancetype)initWithSegments:(NSArray<id<SRGSegment>> *)segments
+{
+    if (self = [super init]) {
+        self.segments = segments ?: @[];
+        [self buildIndex];
+    }
+    return self;
+}
+
+- (instancetype)init
+{
+    return [self initWithSegments:@[]];
+}
+
+- (void)dealloc
+{
+    free(_starts);
+    free(_cumulativeMaxEnds);
+    free(_originalIndexes);
+    free(_visibleIndexesBySegmentIndex);
+    free(_segmentIndexesByVisibleIndex);
+    free(_blockedRanges);
+}
+
+#pragma mark Index construction
+
+- (void)buildIndex
+{
+    NSUInteger count = self.segments.count;
+    _count = count;
+
+    self.indexesBySegment = [NSMapTable mapTableWithKeyOptions:NSPointerFunctionsObjectPointerPersonality | NSPointerFunctionsWeakMemory
+                                                  valueOptions:NSPointerFunctionsStrongMemory];
+    [self.segments enumerateObjectsUsingBlock:^(id<SRGSegment> _Nonnull segment, NSUInteger idx, BOOL * _Nonnull stop) {
+        if (! [self.indexesBySegment objectForKey:segment]) {
+            [self.indexesBySegment setObject:@(idx) forKey:segment];
+        }
+    }];
+
+    if (count == 0) {
+        self.sortedSegments = @[];
+        self.visibleSegments = @[];
+        return;
+    }
+
+    // Partition into visible / hidden segments eagerly, with direct protocol calls (no KVC, no predicate)
+    NSMutableArray<id<SRGSegment>> *visibleSegments = [NSMutableArray arrayWithCapacity:count];
+    _visibleIndexesBySegmentIndex = malloc(count * sizeof(NSUInteger));
+    _segmentIndexesByVisibleIndex = malloc(count * sizeof(NSUInteger));
+    for (NSUInteger i = 0; i < count; ++i) {
+        id<SRGSegment> segment = self.segments[i];
+        if (! segment.srg_hidden) {
+            _visibleIndexesBySegmentIndex[i] = visibleSegments.count;
+            _segmentIndexesByVisibleIndex[visibleSegments.count] = i;
+            [visibleSegments addObject:segment];
+        }
+        else {
+            _visibleIndexesBySegmentIndex[i] = NSNotFound;
+        }
+    }
+    self.visibleSegments = [visibleSegments copy];
+
+    // Sort stably by start time so that segments sharing the same start keep their original relative order
+    NSMutableArray<NSNumber *> *sortedIndexes = [NSMutableArray arrayWithCapacity:count];
+    for (NSUInteger i = 0; i < count; ++i) {
+        [sortedIndexes addObject:@(i)];
+    }
+    [sortedIndexes sortUsingComparator:^NSComparisonResult(NSNumber * _Nonnull index1, NSNumber * _Nonnull index2) {
+        CMTime start1 = [self.segments[index1.unsignedIntegerValue] srg_timeRange].start;
+        CMTime start2 = [self.segments[index2.unsignedIntegerValue] srg_timeRange].start;
+        int32_t comparison = CMTimeCompare(start1, start2);
+        if (comparison != 0) {
+            return (comparison < 0) ? NSOrderedAscending : NSOrderedDescending;
+        }
+        else {
+            return [index1 compare:index2];
+        }
+    }];
+
+    _starts = malloc(count * sizeof(CMTime));
+    _cumulativeMaxEnds = malloc(count * sizeof(CMTime));
+    _originalIndexes = malloc(count * sizeof(NSUInteger));
+
+    NSMutableArray<id<SRGSegment>> *sortedSegments = [NSMutableArray arrayWithCapacity:count];
+    for (NSUInteger i = 0; i < count; ++i) {
+        NSUInteger originalIndex = sortedIndexes[i].unsignedIntegerValue;
+        id<SRGSegment> segment = self.segments[originalIndex];
+        [sortedSegments addObject:segment];
+
+        CMTimeRange timeRange = segment.srg_timeRange;
+        _starts[i] = timeRange.start;
+        _originalIndexes[i] = originalIndex;
+
+        CMTime end = CMTimeRangeGetEnd(timeRange);
+        _cumulativeMaxEnds[i] = (i == 0 || CMTimeCompare(end, _cumulativeMaxEnds[i - 1]) > 0) ? end : _cumulativeMaxEnds[i - 1];
+    }
+    self.sortedSegments = [sortedSegments copy];
+
+    [self buildBlockedRanges];
+}
+
+- (void)buildBlockedRanges
+{
+    // Merge the (already sorted) blocked segment ranges, coalescing overlapping and contiguous ranges
+    _blockedRanges = malloc(_count * sizeof(CMTimeRange));
+    _blockedRangesCount = 0;
+
+    for (id<SRGSegment> segment in self.sortedSegments) {
+        if (! segment.srg_blocked) {
+            continue;
+        }
+
+        CMTimeRange timeRange = segment.srg_timeRange;
+        if (_blockedRangesCount != 0) {
+            CMTimeRange *lastRange = &_blockedRanges[_blockedRangesCount - 1];
+            if (CMTimeCompare(timeRange.start, CMTimeRangeGetEnd(*lastRange)) <= 0) {
+                CMTime end = CMTimeRangeGetEnd(timeRange);
+                if (CMTimeCompare(end, CMTimeRangeGetEnd(*lastRange)) > 0) {
+                    *lastRange = CMTimeRangeFromTimeToTime(lastRange->start, end);
+                }
+                continue;
+            }
+        }
+        _blockedRanges[_blockedRangesCount++] = timeRange;
+    }
+}
+
+#pragma mark Lookups
+
+- (id<SRGSegment>)segmentAtTime:(CMTime)time
+{
+    if (CMTIME_IS_INVALID(time) || _count == 0) {
+        return nil;
+    }
+
+    // Locate the last segment (in sorted order) starting at or before the specified time
+    NSInteger low = 0;
+    NSInteger high = (NSInteger)_count - 1;
+    NSInteger candidate = -1;
+    while (low <= high) {
+        NSInteger mid = (low + high) / 2;
+        if (CMTimeCompare(_starts[mid], time) <= 0) {
+            candidate = mid;
+            low = mid + 1;
+        }
+        else {
+            high = mid - 1;
+        }
+    }
+
+    // Walk backwards over potentially overlapping segments, stopping as soon as no earlier segment can still cover
+    // the time. Among matches, the segment appearing first in the original list wins (linear scan semantics)
+    id<SRGSegment> locatedSegment = nil;
+    NSUInteger locatedOriginalIndex = NSNotFound;
+    for (NSInteger i = candidate; i >= 0; --i) {
+        if (CMTimeCompare(_cumulativeMaxEnds[i], time) <= 0) {
+            break;
+        }
+
+        id<SRGSegment> segment = self.sortedSegments[(NSUInteger)i];
+        if (CMTimeRangeContainsTime(segment.srg_timeRange, time) && _originalIndexes[i] < locatedOriginalIndex) {
+            locatedSegment = segment;
+            locatedOriginalIndex = _originalIndexes[i];
+        }
+    }
+    return locatedSegment;
+}
+
+- (NSUInteger)indexOfSegment:(id<SRGSegment>)segment
+{
+    if (! segment) {
+        return NSNotFound;
+    }
+
+    NSNumber *index = [self.indexesBySegment objectForKey:segment];
+    return index ? index.unsignedIntegerValue : NSNotFound;
+}
+
+- (BOOL)containsSegment:(id<SRGSegment>)segment
+{
+    return [self indexOfSegment:segment] != NSNotFound;
+}
+
+- (NSUInteger)indexOfVisibleSegment:(id<SRGSegment>)segment
+{
+    return [self visibleSegmentIndexForSegmentIndex:[self indexOfSegment:segment]];
+}
+
+- (NSUInteger)segmentIndexForVisibleSegmentIndex:(NSUInteger)visibleSegmentIndex
+{
+    if (visibleSegmentIndex >= self.visibleSegments.count) {
+        return NSNotFound;
+    }
+    return _segmentIndexesByVisibleIndex[visibleSegmentIndex];
+}
+
+- (NSUInteger)visibleSegmentIndexForSegmentIndex:(NSUInteger)segmentIndex
+{
+    if (segmentIndex >= _count) {
+        return NSNotFound;
+    }
+    return _visibleIndexesBySegmentIndex[segmentIndex];
+}
+
+- (BOOL)isTimeBlocked:(CMTime)time
+{
+    return [self blockedRangeIndexForTime:time] != NSNotFound;
+}
+
+- (CMTime)firstNonBlockedTimeAfterTime:(CMTime)time
+{
+    NSUInteger index = [self blockedRangeIndexForTime:time];
+    return (index != NSNotFound) ? CMTimeRangeGetEnd(_blockedRanges[index]) : time;
+}
+
+// Return the index of the merged blocked range containing the specified time, `NSNotFound` if none
+- (NSUInteger)blockedRangeIndexForTime:(CMTime)time
+{
+    if (CMTIME_IS_INVALID(time) || _blockedRangesCount == 0) {
+        return NSNotFound;
+    }
+
+    // Locate the last blocked range starting at or before the specified time. Ranges are disjoint after merging,
+    // no other range can contain the time
+    NSInteger low = 0;
+    NSInteger high = (NSInteger)_blockedRangesCount - 1;
+    NSInteger candidate = -1;
+    while (low <= high) {
+        NSInteger mid = (low + high) / 2;
+        if (CMTimeCompare(_blockedRanges[mid].start, time) <= 0) {
+            candidate = mid;
+            low = mid + 1;
+        }
+        else {
+            high = mid - 1;
+        }
+    }
+
+    if (candidate >= 0 && CMTimeRangeContainsTime(_blockedRanges[candidate], time)) {
+        return (NSUInteger)candidate;
+    }
+    else {
+        return NSNotFound;
+    }
+}
+
+#pragma mark Description
+
+- (NSString *)description
+{
+    return [NSString stringWithFormat:@"<%@: %p; segments: %@>", [self class], self, self.segments];
+}
+
+@end
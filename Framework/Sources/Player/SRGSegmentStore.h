@@ -0,0 +1,105 @@
+//
+//  Copyright (c) SRG SSR. All rights reserved.
+//
+//  License information is available from the LICENSE file.
+//
+
+#import "SRGSegment.h"
+
+#import <CoreMedia/CoreMedia.h>
+#import <Foundation/Foundation.h>
+
+NS_ASSUME_NONNULL_BEGIN
+
+/**
+ *  A compact value-type segment record. Records are the backing storage of `SRGSegmentStore`.
+ */
+typedef struct {
+    CMTimeRange timeRange;
+    BOOL blocked;
+    BOOL hidden;
+    NSUInteger payloadIndex;            // Index into the payload list, `NSNotFound` if the segment has no payload
+} SRGSegmentRecord;
+
+/**
+ *  A compact backing store for very large segment timelines (e.g. EPG feeds with thousands of segments per stream).
+ *
+ *  Retaining one heavyweight segment object per timeline entry, duplicated across every controller displaying the
+ *  same stream (inline, fullscreen, picture in picture), wastes multiple megabytes. A store instead keeps plain
+ *  value records of (time range, flags, payload index) in a single contiguous buffer, with an optional shared
+ *  payload list for the data the user interface actually displays.
+ *
+ *  `id<SRGSegment>` façade objects are materialized lazily, only when a segment is actually asked for, and keep a
+ *  stable identity afterwards. The `segments` property returns a lazy array view which can be handed directly to
+ *  the `SRGMediaPlayerController` play and prepare methods.
+ *
+ *  A store is immutable and can therefore be freely shared between any number of controllers without copying.
+ */
+@interface SRGSegmentStore : NSObject <NSCopying>
+
+/**
+ *  Create a store from a record list, copied into the store.
+ *
+ *  @param records  The records to store (can be `NULL` iff `count` is 0).
+ *  @param count    The number of records.
+ *  @param payloads An optional payload list, shared by all segments referring into it through their payload index.
+ */
++ (SRGSegmentStore *)segmentStoreWithRecords:(nullable const SRGSegmentRecord *)records
+                                       count:(NSUInteger)count
+                                    payloads:(nullable NSArray *)payloads;
+
+/**
+ *  Same as `+segmentStoreWithRecords:count:payloads:`, without payloads.
+ */
++ (SRGSegmentStore *)segmentStoreWithRecords:(nullable const SRGSegmentRecord *)records count:(NSUInteger)count;
+
+/**
+ *  The number of segments in the store.
+ */
+@property (nonatomic, readonly) NSUInteger count;
+
+/**
+ *  The segments of the store, in record order, as a lazy array view. Accessing an entry materializes the
+ *  corresponding façade; entries which are never accessed cost nothing beyond their record.
+ */
+@property (nonatomic, readonly) NSArray<id<SRGSegment>> *segments;
+
+/**
+ *  Return the segment façade at the specified index (the same instance is returned for repeated calls), `nil` if
+ *  the index is invalid.
+ */
+- (nullable id<SRGSegment>)segmentAtIndex:(NSUInteger)index;
+
+/**
+ *  Return the payload associated with the segment at the specified index, `nil` if none.
+ */
+- (nullable id)payloadAtIndex:(NSUInteger)index;
+
+@end
+
+/**
+ *  The façade class materialized by `SRGSegmentStore`. Conforms to `SRGSegment` and gives access to the payload
+ *  associated with the segment, if any.
+ */
+@interface SRGStoredSegment : NSObject <SRGSegment>
+
+/**
+ *  The payload associated with the segment, `nil` if none.
+ */
+@property (nonatomic, readonly, nullable) id payload;
+
+@end
+
+@interface SRGSegmentStore (Unavailable)
+
+- (instancetype)init NS_UNAVAILABLE;
+
+@end
+
+@interface SRGStoredSegment (Unavailable)
+
+- (instancetype)init NS_UNAVAILABLE;
+
+@end
+
+NS_ASSUME_NONNULL_END
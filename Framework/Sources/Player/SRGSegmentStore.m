@@ -0,0 +1,216 @@
+//
+//  Copyright (c) SRG SSR. All rights reserved.
+//
+//  License information is available from the LICENSE file.
+//
+
+#import "SRGSegmentStore.h"
+
+@interface SRGStoredSegment ()
+
+@property (nonatomic) CMTimeRange timeRange;
+@property (nonatomic, getter=isBlocked) BOOL blocked;
+@property (nonatomic, getter=isHidden) BOOL hidden;
+@property (nonatomic, nullable) id payload;
+
+@end
+
+@implementation SRGStoredSegment
+
+#pragma mark Object lifecycle
+
+- (instancetype)initWithRecord:(SRGSegmentRecord)record payload:(id)payload
+{
+    if (self = [super init]) {
+        self.timeRange = record.timeRange;
+        self.blocked = record.blocked;
+        self.hidden = record.hidden;
+        self.payload = payload;
+    }
+    return self;
+}
+
+#pragma mark SRGSegment protocol
+
+- (CMTimeRange)srg_timeRange
+{
+    return self.timeRange;
+}
+
+- (BOOL)srg_isBlocked
+{
+    return self.blocked;
+}
+
+- (BOOL)srg_isHidden
+{
+    return self.hidden;
+}
+
+#pragma mark Description
+
+- (NSString *)description
+{
+    return [NSString stringWithFormat:@"<%@: %p; start: %@; duration: %@; blocked: %@; hidden: %@>",
+            [self class],
+            self,
+            @(CMTimeGetSeconds(self.timeRange.start)),
+            @(CMTimeGetSeconds(self.timeRange.duration)),
+            self.blocked ? @"YES" : @"NO",
+            self.hidden ? @"YES" : @"NO"];
+}
+
+@end
+
+/**
+ *  Lazy array view over a store. Only `-count` and `-objectAtIndex:` are implemented, which suffices for an
+ *  immutable `NSArray` subclass; all other array methods are provided by the `NSArray` class cluster on top
+ *  of these two primitives.
+ */
+@interface SRGSegmentStoreArray : NSArray
+
+- (instancetype)initWithSegmentStore:(SRGSegmentStore *)segmentStore;
+
+@end
+
+@interface SRGSegmentStore () {
+@private
+    SRGSegmentRecord *_records;
+}
+
+@property (nonatomic) NSArray *payloads;
+
+// Façades materialized so far, keyed by index. Façades must keep a stable identity, since segment lookups
+// performed by `SRGSegmentIndex` are identity-based
+@property (nonatomic) NSMutableDictionary<NSNumber *, SRGStoredSegment *> *materializedSegments;
+
+@end
+
+@implementation SRGSegmentStore
+
+@synthesize count = _count;
+
+#pragma mark Class methods
+
++ (SRGSegmentStore *)segmentStoreWithRecords:(const SRGSegmentRecord *)records count:(NSUInteger)count payloads:(NSArray *)payloads
+{
+    return [[[self class] alloc] initWithRecords:records count:count payloads:payloads];
+}
+
++ (SRGSegmentStore *)segmentStoreWithRecords:(const SRGSegmentRecord *)records count:(NSUInteger)count
+{
+    return [self segmentStoreWithRecords:records count:count payloads:nil];
+}
+
+#pragma mark Object lifecycle
+
+- (instancetype)initWithRecords:(const SRGSegmentRecord *)records count:(NSUInteger)count payloads:(NSArray *)payloads
+{
+    NSParameterAssert(records != NULL || count == 0);
+
+    if (self = [super init]) {
+        _count = count;
+
+        if (count != 0) {
+            _records = malloc(count * sizeof(SRGSegmentRecord));
+            memcpy(_records, records, count * sizeof(SRGSegmentRecord));
+        }
+
+        self.payloads = payloads;
+        self.materializedSegments = [NSMutableDictionary dictionary];
+    }
+    return self;
+}
+
+- (void)dealloc
+{
+    free(_records);
+}
+
+#pragma mark Getters and setters
+
+- (NSArray<id<SRGSegment>> *)segments
+{
+    // The view is a trivial wrapper around the store. Return a fresh instance instead of caching one, which
+    // would create a retain cycle (the view must retain the store it reads from)
+    return [[SRGSegmentStoreArray alloc] initWithSegmentStore:self];
+}
+
+#pragma mark Segment access
+
+- (id<SRGSegment>)segmentAtIndex:(NSUInteger)index
+{
+    if (index >= _count) {
+        return nil;
+    }
+
+    NSNumber *key = @(index);
+    SRGStoredSegment *segment = self.materializedSegments[key];
+    if (! segment) {
+        segment = [[SRGStoredSegment alloc] initWithRecord:_records[index] payload:[self payloadAtIndex:index]];
+        self.materializedSegments[key] = segment;
+    }
+    return segment;
+}
+
+- (id)payloadAtIndex:(NSUInteger)index
+{
+    if (index >= _count) {
+        return nil;
+    }
+
+    NSUInteger payloadIndex = _records[index].payloadIndex;
+    if (payloadIndex == NSNotFound || payloadIndex >= self.payloads.count) {
+        return nil;
+    }
+    return self.payloads[payloadIndex];
+}
+
+#pragma mark NSCopying protocol
+
+- (id)copyWithZone:(NSZone *)zone
+{
+    // The store is immutable, copies can share the same instance
+    return self;
+}
+
+#pragma mark Description
+
+- (NSString *)description
+{
+    return [NSString stringWithFormat:@"<%@: %p; count: %@>", [self class], self, @(self.count)];
+}
+
+@end
+
+@interface SRGSegmentStoreArray ()
+
+@property (nonatomic) SRGSegmentStore *segmentStore;
+
+@end
+
+@implementation SRGSegmentStoreArray
+
+- (instancetype)initWithSegmentStore:(SRGSegmentStore *)segmentStore
+{
+    if (self = [super init]) {
+        self.segmentStore = segmentStore;
+    }
+    return self;
+}
+
+- (NSUInteger)count
+{
+    return self.segmentStore.count;
+}
+
+- (id)objectAtIndex:(NSUInteger)index
+{
+    id<SRGSegment> segment = [self.segmentStore segmentAtIndex:index];
+    if (! segment) {
+        [NSException raise:NSRangeException format:@"Index %@ is out of bounds (0 ..< %@)", @(index), @(self.count)];
+    }
+    return segment;
+}
+
+@end
@@ -0,0 +1,114 @@
+//
+//  Copyright (c) SRG SSR. All rights reserved.
+//
+//  License information is available from the LICENSE file.
+//
+
+#import "Segment.h"
+
+#import <SRGMediaPlayer/SRGMediaPlayer.h>
+#import <XCTest/XCTest.h>
+
+// Expose private interfaces exercised by the benchmarks. These hot paths are internal but their cost directly drives
+// per-tick main thread usage, which is why they are tracked like functional behavior
+@interface SRGMediaPlayerController (PerformanceTests)
+
+- (void)setSegments:(NSArray<id<SRGSegment>> *)segments;
+- (nullable id<SRGSegment>)segmentForTime:(CMTime)time;
+
+@end
+
+@interface SRGTimeSlider (PerformanceTests)
+
+- (void)updateRendering;
+
+@end
+
+@interface PerformanceTestCase : XCTestCase
+
+@end
+
+@implementation PerformanceTestCase
+
+#pragma mark Helpers
+
+- (NSArray<id<SRGSegment>> *)segmentsWithCount:(NSUInteger)count
+{
+    NSMutableArray<id<SRGSegment>> *segments = [NSMutableArray array];
+    for (NSUInteger i = 0; i < count; ++i) {
+        CMTimeRange timeRange = CMTimeRangeMake(CMTimeMakeWithSeconds(2. * i, NSEC_PER_SEC), CMTimeMakeWithSeconds(1., NSEC_PER_SEC));
+        [segments addObject:[Segment segmentWithTimeRange:timeRange]];
+    }
+    return [segments copy];
+}
+
+#pragma mark Tests
+
+- (void)testSegmentUpdatePerformanceWith100Segments
+{
+    SRGMediaPlayerController *mediaPlayerController = [[SRGMediaPlayerController alloc] init];
+    NSArray<id<SRGSegment>> *segments = [self segmentsWithCount:100];
+    [self measureBlock:^{
+        mediaPlayerController.segments = segments;
+    }];
+}
+
+- (void)testSegmentUpdatePerformanceWith1000Segments
+{
+    SRGMediaPlayerController *mediaPlayerController = [[SRGMediaPlayerController alloc] init];
+    NSArray<id<SRGSegment>> *segments = [self segmentsWithCount:1000];
+    [self measureBlock:^{
+        mediaPlayerController.segments = segments;
+    }];
+}
+
+- (void)testSegmentUpdatePerformanceWith10000Segments
+{
+    SRGMediaPlayerController *mediaPlayerController = [[SRGMediaPlayerController alloc] init];
+    NSArray<id<SRGSegment>> *segments = [self segmentsWithCount:10000];
+    [self measureBlock:^{
+        mediaPlayerController.segments = segments;
+    }];
+}
+
+// Approximates the per-tick cost of the segment periodic observer, which performs one lookup per tick
+- (void)testSegmentLookupPerformance
+{
+    SRGMediaPlayerController *mediaPlayerController = [[SRGMediaPlayerController alloc] init];
+    mediaPlayerController.segments = [self segmentsWithCount:10000];
+    [self measureBlock:^{
+        for (NSUInteger i = 0; i < 1000; ++i) {
+            CMTime time = CMTimeMakeWithSeconds((20000. * i) / 1000., NSEC_PER_SEC);
+            [mediaPlayerController segmentForTime:time];
+        }
+    }];
+}
+
+// Registration cost with many periodic observers attached to the same controller
+- (void)testPeriodicTimeObserverFanOutPerformance
+{
+    SRGMediaPlayerController *mediaPlayerController = [[SRGMediaPlayerController alloc] init];
+    [self measureBlock:^{
+        NSMutableArray<id> *observers = [NSMutableArray array];
+        for (NSUInteger i = 0; i < 1000; ++i) {
+            id observer = [mediaPlayerController addPeriodicTimeObserverForInterval:CMTimeMakeWithSeconds(1., NSEC_PER_SEC) queue:NULL usingBlock:^(CMTime time) {}];
+            [observers addObject:observer];
+        }
+        for (id observer in observers) {
+            [mediaPlayerController removePeriodicTimeObserver:observer];
+        }
+    }];
+}
+
+- (void)testTimeSliderUpdatePerformance
+{
+    SRGTimeSlider *slider = [[SRGTimeSlider alloc] initWithFrame:CGRectMake(0.f, 0.f, 320.f, 44.f)];
+    [self measureBlock:^{
+        for (NSUInteger i = 0; i < 1000; ++i) {
+            slider.value = i % 100;
+            [slider updateRendering];
+        }
+    }];
+}
+
+@end
@@ -727,6 +727,55 @@ static NSURL *AudioOverHTTPTestURL(void)
     XCTAssertTrue([[NSDate date] timeIntervalSinceDate:self.mediaPlayerController.date] > 38);
 }
 
+- (void)testDateIndexing
+{
+    [self expectationForNotification:SRGMediaPlayerPlaybackStateDidChangeNotification object:self.mediaPlayerController handler:^BOOL(NSNotification * _Nonnull notification) {
+        return [notification.userInfo[SRGMediaPlayerPlaybackStateKey] integerValue] == SRGMediaPlayerPlaybackStatePlaying;
+    }];
+
+    [self.mediaPlayerController playURL:DVRTestURL()];
+
+    [self waitForExpectationsWithTimeout:20. handler:nil];
+
+    XCTAssertEqual(self.mediaPlayerController.streamType, SRGMediaPlayerStreamTypeDVR);
+
+    // The conversions must round-trip and be consistent with the date property
+    CMTime currentTime = self.mediaPlayerController.currentTime;
+    NSDate *date = [self.mediaPlayerController dateForTime:currentTime];
+    XCTAssertNotNil(date);
+    XCTAssertTrue(fabs([date timeIntervalSinceDate:self.mediaPlayerController.date]) < 0.5);
+
+    CMTime time = [self.mediaPlayerController timeForDate:date];
+    XCTAssertTrue(CMTIME_IS_VALID(time));
+    XCTAssertTrue(fabs(CMTimeGetSeconds(CMTimeSubtract(time, currentTime))) < 0.5);
+
+    // A date 10 seconds in the past must map 10 seconds before the current position
+    CMTime pastTime = [self.mediaPlayerController timeForDate:[date dateByAddingTimeInterval:-10.]];
+    XCTAssertTrue(fabs(CMTimeGetSeconds(CMTimeSubtract(currentTime, pastTime)) - 10.) < 0.5);
+
+    // Dates far outside the DVR window must clamp to its bounds
+    CMTime distantPastTime = [self.mediaPlayerController timeForDate:NSDate.distantPast];
+    XCTAssertTrue(CMTIME_COMPARE_INLINE(distantPastTime, ==, self.mediaPlayerController.timeRange.start));
+
+    XCTAssertNil([self.mediaPlayerController dateForTime:kCMTimeInvalid]);
+    XCTAssertTrue(CMTIME_IS_INDEFINITE([self.mediaPlayerController timeForDate:nil]));
+}
+
+- (void)testDateIndexingForOnDemandStream
+{
+    [self expectationForNotification:SRGMediaPlayerPlaybackStateDidChangeNotification object:self.mediaPlayerController handler:^BOOL(NSNotification * _Nonnull notification) {
+        return [notification.userInfo[SRGMediaPlayerPlaybackStateKey] integerValue] == SRGMediaPlayerPlaybackStatePlaying;
+    }];
+
+    [self.mediaPlayerController playURL:OnDemandTestURL()];
+
+    [self waitForExpectationsWithTimeout:20. handler:nil];
+
+    // No date mapping exists for on-demand streams
+    XCTAssertTrue(CMTIME_IS_INDEFINITE([self.mediaPlayerController timeForDate:[NSDate date]]));
+    XCTAssertNil([self.mediaPlayerController dateForTime:self.mediaPlayerController.currentTime]);
+}
+
 - (void)testLiveTolerance
 {
     [self expectationForNotification:SRGMediaPlayerPlaybackStateDidChangeNotification object:self.mediaPlayerController handler:^BOOL(NSNotification * _Nonnull notification) {
@@ -0,0 +1,114 @@
+//
+//  Copyright (c) SRG SSR. All rights reserved.
+//
+//  License information is available from the LICENSE file.
+//
+
+#import <SRGMediaPlayer/SRGMediaPlayer.h>
+#import <XCTest/XCTest.h>
+
+@interface SegmentStoreTestCase : XCTestCase
+
+@end
+
+@implementation SegmentStoreTestCase
+
+#pragma mark Tests
+
+- (void)testRecordRoundTrip
+{
+    SRGSegmentRecord records[] = {
+        { .timeRange = CMTimeRangeMake(CMTimeMakeWithSeconds(2., NSEC_PER_SEC), CMTimeMakeWithSeconds(3., NSEC_PER_SEC)), .blocked = NO, .hidden = NO, .payloadIndex = NSNotFound },
+        { .timeRange = CMTimeRangeMake(CMTimeMakeWithSeconds(5., NSEC_PER_SEC), CMTimeMakeWithSeconds(4., NSEC_PER_SEC)), .blocked = YES, .hidden = YES, .payloadIndex = NSNotFound }
+    };
+    SRGSegmentStore *segmentStore = [SRGSegmentStore segmentStoreWithRecords:records count:2];
+    XCTAssertEqual(segmentStore.count, 2);
+
+    id<SRGSegment> segment1 = [segmentStore segmentAtIndex:0];
+    XCTAssertTrue(CMTimeRangeEqual(segment1.srg_timeRange, records[0].timeRange));
+    XCTAssertFalse(segment1.srg_blocked);
+    XCTAssertFalse(segment1.srg_hidden);
+
+    id<SRGSegment> segment2 = [segmentStore segmentAtIndex:1];
+    XCTAssertTrue(CMTimeRangeEqual(segment2.srg_timeRange, records[1].timeRange));
+    XCTAssertTrue(segment2.srg_blocked);
+    XCTAssertTrue(segment2.srg_hidden);
+}
+
+- (void)testFacadeIdentityStability
+{
+    SRGSegmentRecord records[] = {
+        { .timeRange = CMTimeRangeMake(CMTimeMakeWithSeconds(2., NSEC_PER_SEC), CMTimeMakeWithSeconds(3., NSEC_PER_SEC)), .payloadIndex = NSNotFound }
+    };
+    SRGSegmentStore *segmentStore = [SRGSegmentStore segmentStoreWithRecords:records count:1];
+
+    // Identity stability is a requirement for pointer-keyed segment lookups (see `SRGSegmentIndex`)
+    XCTAssertTrue([segmentStore segmentAtIndex:0] == [segmentStore segmentAtIndex:0]);
+    XCTAssertTrue([segmentStore segmentAtIndex:0] == segmentStore.segments[0]);
+    XCTAssertTrue(segmentStore.segments[0] == segmentStore.segments[0]);
+}
+
+- (void)testPayloads
+{
+    SRGSegmentRecord records[] = {
+        { .timeRange = CMTimeRangeMake(kCMTimeZero, CMTimeMakeWithSeconds(3., NSEC_PER_SEC)), .payloadIndex = 1 },
+        { .timeRange = CMTimeRangeMake(CMTimeMakeWithSeconds(3., NSEC_PER_SEC), CMTimeMakeWithSeconds(3., NSEC_PER_SEC)), .payloadIndex = 0 },
+        { .timeRange = CMTimeRangeMake(CMTimeMakeWithSeconds(6., NSEC_PER_SEC), CMTimeMakeWithSeconds(3., NSEC_PER_SEC)), .payloadIndex = NSNotFound }
+    };
+    SRGSegmentStore *segmentStore = [SRGSegmentStore segmentStoreWithRecords:records count:3 payloads:@[ @"title1", @"title2" ]];
+
+    XCTAssertEqualObjects([segmentStore payloadAtIndex:0], @"title2");
+    XCTAssertEqualObjects([segmentStore payloadAtIndex:1], @"title1");
+    XCTAssertNil([segmentStore payloadAtIndex:2]);
+
+    SRGStoredSegment *segment = [segmentStore segmentAtIndex:0];
+    XCTAssertEqualObjects(segment.payload, @"title2");
+}
+
+- (void)testArrayViewBounds
+{
+    SRGSegmentRecord records[] = {
+        { .timeRange = CMTimeRangeMake(kCMTimeZero, CMTimeMakeWithSeconds(3., NSEC_PER_SEC)), .payloadIndex = NSNotFound },
+        { .timeRange = CMTimeRangeMake(CMTimeMakeWithSeconds(3., NSEC_PER_SEC), CMTimeMakeWithSeconds(3., NSEC_PER_SEC)), .payloadIndex = NSNotFound }
+    };
+    SRGSegmentStore *segmentStore = [SRGSegmentStore segmentStoreWithRecords:records count:2];
+
+    NSArray<id<SRGSegment>> *segments = segmentStore.segments;
+    XCTAssertEqual(segments.count, 2);
+    XCTAssertNotNil(segments[0]);
+    XCTAssertNotNil(segments[1]);
+    XCTAssertThrowsSpecificNamed([segments objectAtIndex:2], NSException, NSRangeException);
+
+    // Out-of-bounds accesses on the store itself return nil instead
+    XCTAssertNil([segmentStore segmentAtIndex:2]);
+    XCTAssertNil([segmentStore payloadAtIndex:2]);
+
+    // Fast enumeration must walk all entries
+    NSUInteger count = 0;
+    for (id<SRGSegment> segment in segments) {
+        XCTAssertTrue([segment conformsToProtocol:@protocol(SRGSegment)]);
+        ++count;
+    }
+    XCTAssertEqual(count, 2);
+}
+
+- (void)testEmptyStore
+{
+    SRGSegmentStore *segmentStore = [SRGSegmentStore segmentStoreWithRecords:NULL count:0];
+    XCTAssertEqual(segmentStore.count, 0);
+    XCTAssertEqual(segmentStore.segments.count, 0);
+    XCTAssertNil([segmentStore segmentAtIndex:0]);
+}
+
+- (void)testCopyIsShared
+{
+    SRGSegmentRecord records[] = {
+        { .timeRange = CMTimeRangeMake(kCMTimeZero, CMTimeMakeWithSeconds(3., NSEC_PER_SEC)), .payloadIndex = NSNotFound }
+    };
+    SRGSegmentStore *segmentStore = [SRGSegmentStore segmentStoreWithRecords:records count:1];
+
+    // Stores are immutable, a copy is the same instance
+    XCTAssertTrue([segmentStore copy] == segmentStore);
+}
+
+@end